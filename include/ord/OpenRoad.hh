@@ -237,8 +237,13 @@ class OpenRoad
   void read3DBloxBMap(const std::string& filename);
   void check3DBlox();
 
-  void readDb(std::istream& stream);
-  void readDb(const char* filename, bool hierarchy = false);
+  void readDb(std::istream& stream,
+              bool skip_wires = false,
+              bool skip_parasitics = false);
+  void readDb(const char* filename,
+              bool hierarchy = false,
+              bool skip_wires = false,
+              bool skip_parasitics = false);
   void writeDb(std::ostream& stream);
   void writeDb(const char* filename);
 
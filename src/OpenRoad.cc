@@ -380,6 +380,7 @@ void OpenRoad::readDef(const char* filename,
   if (continue_on_errors) {
     def_reader.continueOnErrors();
   }
+  def_reader.setThreads(threads_);
   def_reader.readChip(search_libs, filename, chip);
 }
 
@@ -425,6 +426,7 @@ void OpenRoad::writeDef(const char* filename, const std::string& version)
       }
       odb::DefOut def_writer(logger_);
       def_writer.setVersion(stringToDefVersion(version));
+      def_writer.setThreads(threads_);
       def_writer.writeBlock(block, filename);
       if (hierarchy_set) {
         sta->getDbNetwork()->setHierarchy();
@@ -554,11 +556,14 @@ void OpenRoad::write3Dbx(const std::string& filename)
 
 // TODO: bool hierarchy should be removed in the future.
 // It is retained for a while for backward compatibility.
-void OpenRoad::readDb(const char* filename, bool hierarchy)
+void OpenRoad::readDb(const char* filename,
+                      bool hierarchy,
+                      bool skip_wires,
+                      bool skip_parasitics)
 {
   try {
     utl::InStreamHandler handler(filename, true);
-    readDb(handler.getStream());
+    readDb(handler.getStream(), skip_wires, skip_parasitics);
   } catch (const std::ios_base::failure& f) {
     logger_->error(ORD, 54, "odb file {} is invalid: {}", filename, f.what());
   }
@@ -577,7 +582,9 @@ void OpenRoad::readDb(const char* filename, bool hierarchy)
   }
 }
 
-void OpenRoad::readDb(std::istream& stream)
+void OpenRoad::readDb(std::istream& stream,
+                      bool skip_wires,
+                      bool skip_parasitics)
 {
   if (db_->getChip() && db_->getChip()->getBlock()) {
     logger_->error(
@@ -587,13 +594,13 @@ void OpenRoad::readDb(std::istream& stream)
   stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
                     | std::ios::eofbit);
 
-  db_->read(stream);
+  db_->read(stream, threads_, skip_wires, skip_parasitics);
 }
 
 void OpenRoad::writeDb(std::ostream& stream)
 {
   stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  db_->write(stream);
+  db_->write(stream, threads_);
 }
 
 void OpenRoad::writeDb(const char* filename)
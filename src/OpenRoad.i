@@ -409,10 +409,13 @@ write_3dbx_cmd(const char *filename)
 }
 
 void
-read_db_cmd(const char *filename, bool hierarchy)
+read_db_cmd(const char *filename,
+            bool hierarchy,
+            bool skip_wires,
+            bool skip_parasitics)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->readDb(filename, hierarchy);
+  ord->readDb(filename, hierarchy, skip_wires, skip_parasitics);
 }
 
 void
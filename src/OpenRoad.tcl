@@ -238,13 +238,15 @@ proc check_3dblox { args } {
 
 sta::define_cmd_args "write_db" {filename}
 
-sta::define_cmd_args "read_db" {[-hier] filename}
+sta::define_cmd_args "read_db" {[-hier] [-skip_wires] [-skip_parasitics]\
+                                  filename}
 
 proc read_db { args } {
   # TODO: -hier is not needed anymore.
   # - It will be removed in a future release.
   # - It is currently retained for backward compatibility.
-  sta::parse_key_args "read_db" args keys {} flags {-hier}
+  sta::parse_key_args "read_db" args keys {} \
+    flags {-hier -skip_wires -skip_parasitics}
   sta::check_argc_eq1or2 "read_db" $args
   set filename [file nativename [lindex $args 0]]
   if { ![file exists $filename] } {
@@ -254,7 +256,9 @@ proc read_db { args } {
   if { ![file readable $filename] } {
     utl::error "ORD" 8 "$filename is not readable."
   }
-  ord::read_db_cmd $filename $hierarchy
+  set skip_wires [info exists flags(-skip_wires)]
+  set skip_parasitics [info exists flags(-skip_parasitics)]
+  ord::read_db_cmd $filename $hierarchy $skip_wires $skip_parasitics
 }
 
 sta::define_cmd_args "write_db" {filename}
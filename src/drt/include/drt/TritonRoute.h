@@ -78,6 +78,9 @@ struct ParamStruct
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
   int num_threads = 1;
+  std::string pinAccessCacheFile;
+  int mazeLandmarks = 0;
+  int workerProcesses = 0;
 };
 
 class TritonRoute : public PinAccessService
@@ -145,6 +148,10 @@ class TritonRoute : public PinAccessService
   void setDebugPaEdge(bool on = true);
   void setDebugPaCommit(bool on = true);
   void reportConstraints();
+  // Record ProfileTask scopes and write them as a Chrome trace.
+  void startTrace();
+  void stopTrace();
+  void writeTrace(const std::string& file_name);
 
   void setParams(const ParamStruct& params);
   void addUserSelectedVia(const std::string& viaName);
@@ -179,7 +186,11 @@ class TritonRoute : public PinAccessService
                 int x2,
                 int y2,
                 const std::string& marker_name,
+                bool incremental,
                 int num_threads);
+  // Records a region changed since the last check_drc so that an
+  // incremental check only re-checks the tiles around it.
+  void addDRCDirtyRegion(const odb::Rect& region);
   bool initGuide();
   void prep();
   odb::dbDatabase* getDb() const { return db_; }
@@ -212,14 +223,22 @@ class TritonRoute : public PinAccessService
   std::optional<boost::asio::thread_pool> dist_pool_;
   std::unique_ptr<FlexPA> pa_{nullptr};
   std::unique_ptr<AbstractGraphicsFactory> graphics_factory_{nullptr};
+  // Results of the last check_drc, reused by incremental checks.
+  std::list<std::unique_ptr<frMarker>> drc_markers_;
+  odb::Rect drc_box_;
+  bool drc_baseline_{false};
+  std::vector<odb::Rect> drc_dirty_regions_;
 
   void initDesign();
   void initGraphics();
+  void initPinAccessCache();
   void ta();
   void dr();
   void applyUpdates(const std::vector<std::vector<drUpdate>>& updates);
   void getDRCMarkers(std::list<std::unique_ptr<frMarker>>& markers,
-                     const odb::Rect& requiredDrcBox);
+                     const odb::Rect& requiredDrcBox,
+                     const std::vector<odb::Rect>* dirty_regions = nullptr);
+  void clearDRCBaseline();
   void repairPDNVias();
   friend class FlexDR;
 };
@@ -3,10 +3,14 @@
 
 #include "DesignCallBack.h"
 
+#include "db/obj/frNet.h"
+#include "db/obj/frShape.h"
+#include "db/obj/frVia.h"
 #include "drt/TritonRoute.h"
 #include "frDesign.h"
 #include "io/io.h"
 #include "odb/db.h"
+#include "odb/geom.h"
 
 namespace drt {
 
@@ -22,6 +26,7 @@ void DesignCallBack::inDbInstCreate(odb::dbInst* db_inst)
                     router_->getRouterConfiguration());
 
   parser.setInst(db_inst);
+  addDirtyRegion(db_inst);
 }
 
 void DesignCallBack::inDbPreMoveInst(odb::dbInst* db_inst)
@@ -30,6 +35,7 @@ void DesignCallBack::inDbPreMoveInst(odb::dbInst* db_inst)
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_inst);
   auto inst = design->getTopBlock()->getInst(db_inst->getName());
   if (inst == nullptr) {
     return;
@@ -46,6 +52,7 @@ void DesignCallBack::inDbPostMoveInst(odb::dbInst* db_inst)
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_inst);
   auto inst = design->getTopBlock()->getInst(db_inst->getName());
   if (inst == nullptr) {
     return;
@@ -66,6 +73,7 @@ void DesignCallBack::inDbInstDestroy(odb::dbInst* db_inst)
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_inst);
   auto inst = design->getTopBlock()->getInst(db_inst->getName());
   if (inst == nullptr) {
     return;
@@ -112,6 +120,7 @@ void DesignCallBack::inDbNetDestroy(odb::dbNet* db_net)
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_net);
   auto net = design->getTopBlock()->findNet(db_net->getName());
   if (net == nullptr) {
     return;
@@ -126,6 +135,7 @@ void DesignCallBack::inDbITermPostDisconnect(odb::dbITerm* db_iterm,
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_iterm->getInst());
   auto inst = design->getTopBlock()->findInst(db_iterm->getInst());
   auto net = design->getTopBlock()->findNet(db_net->getName());
   if (inst == nullptr || net == nullptr) {
@@ -145,6 +155,7 @@ void DesignCallBack::inDbITermPostConnect(odb::dbITerm* db_iterm)
   if (design == nullptr || design->getTopBlock() == nullptr) {
     return;
   }
+  addDirtyRegion(db_iterm->getInst());
   auto inst = design->getTopBlock()->findInst(db_iterm->getInst());
   auto net = design->getTopBlock()->findNet(db_iterm->getNet()->getName());
   if (inst == nullptr || net == nullptr) {
@@ -159,4 +170,162 @@ void DesignCallBack::inDbITermPostConnect(odb::dbITerm* db_iterm)
   router_->addInstancePAData(inst);
 }
 
+void DesignCallBack::inDbWireCreate(odb::dbWire* db_wire)
+{
+  if (db_wire->getNet() != nullptr) {
+    addDirtyRegion(db_wire->getNet());
+  }
+}
+
+void DesignCallBack::inDbWirePostModify(odb::dbWire* db_wire)
+{
+  if (db_wire->getNet() != nullptr) {
+    addDirtyRegion(db_wire->getNet());
+  }
+}
+
+void DesignCallBack::inDbWireDestroy(odb::dbWire* db_wire)
+{
+  if (db_wire->getNet() != nullptr) {
+    addDirtyRegion(db_wire->getNet());
+  }
+}
+
+void DesignCallBack::inDbWirePostAttach(odb::dbWire* db_wire)
+{
+  if (db_wire->getNet() != nullptr) {
+    addDirtyRegion(db_wire->getNet());
+  }
+}
+
+void DesignCallBack::inDbWirePostDetach(odb::dbWire* db_wire,
+                                        odb::dbNet* db_net)
+{
+  addDirtyRegion(db_net);
+  if (auto bbox = db_wire->getBBox()) {
+    addDirtyRegion(*bbox);
+  }
+}
+
+void DesignCallBack::inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst)
+{
+  inDbWirePostModify(dst);
+}
+
+void DesignCallBack::inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst)
+{
+  inDbWirePostModify(dst);
+}
+
+void DesignCallBack::inDbSWireAddSBox(odb::dbSBox* box)
+{
+  addDirtyRegion(box->getBox());
+}
+
+void DesignCallBack::inDbSWireRemoveSBox(odb::dbSBox* box)
+{
+  addDirtyRegion(box->getBox());
+}
+
+void DesignCallBack::inDbSWirePreDestroySBoxes(odb::dbSWire* wire)
+{
+  for (odb::dbSBox* box : wire->getWires()) {
+    addDirtyRegion(box->getBox());
+  }
+}
+
+void DesignCallBack::inDbObstructionCreate(odb::dbObstruction* obstruction)
+{
+  addDirtyRegion(obstruction->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbObstructionDestroy(odb::dbObstruction* obstruction)
+{
+  addDirtyRegion(obstruction->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbBlockageCreate(odb::dbBlockage* blockage)
+{
+  addDirtyRegion(blockage->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbBlockageDestroy(odb::dbBlockage* blockage)
+{
+  addDirtyRegion(blockage->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbBPinAddBox(odb::dbBox* box)
+{
+  addDirtyRegion(box->getBox());
+}
+
+void DesignCallBack::inDbBPinRemoveBox(odb::dbBox* box)
+{
+  addDirtyRegion(box->getBox());
+}
+
+void DesignCallBack::inDbBPinDestroy(odb::dbBPin* pin)
+{
+  addDirtyRegion(pin->getBBox());
+}
+
+// A pin changing nets changes which spacing rules apply next to it.
+void DesignCallBack::inDbBTermPostConnect(odb::dbBTerm* term)
+{
+  addDirtyRegion(term->getBBox());
+}
+
+void DesignCallBack::inDbBTermPostDisConnect(odb::dbBTerm* term,
+                                             odb::dbNet* net)
+{
+  addDirtyRegion(term->getBBox());
+}
+
+void DesignCallBack::inDbBTermDestroy(odb::dbBTerm* term)
+{
+  addDirtyRegion(term->getBBox());
+}
+
+void DesignCallBack::addDirtyRegion(odb::dbInst* db_inst)
+{
+  router_->addDRCDirtyRegion(db_inst->getBBox()->getBox());
+}
+
+// Pins without shapes have an inverted bbox and change nothing.
+void DesignCallBack::addDirtyRegion(const odb::Rect& region)
+{
+  if (!region.isInverted()) {
+    router_->addDRCDirtyRegion(region);
+  }
+}
+
+// Covers both the routing drt last read for the net, which is what the
+// previous check_drc saw, and the net's current wire in odb.
+void DesignCallBack::addDirtyRegion(odb::dbNet* db_net)
+{
+  auto design = router_->getDesign();
+  if (design == nullptr || design->getTopBlock() == nullptr) {
+    return;
+  }
+  odb::Rect region;
+  region.mergeInit();
+  if (auto net = design->getTopBlock()->findNet(db_net->getName())) {
+    for (const auto& shape : net->getShapes()) {
+      region.merge(shape->getBBox());
+    }
+    for (const auto& via : net->getVias()) {
+      region.merge(via->getBBox());
+    }
+    for (const auto& patch : net->getPatchWires()) {
+      region.merge(patch->getBBox());
+    }
+  }
+  if (db_net->getWire() != nullptr) {
+    if (auto bbox = db_net->getWire()->getBBox()) {
+      region.merge(*bbox);
+    }
+  }
+  addDirtyRegion(region);
+}
+
 }  // namespace drt
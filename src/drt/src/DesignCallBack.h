@@ -21,8 +21,32 @@ class DesignCallBack : public odb::dbBlockCallBackObj
   void inDbNetDestroy(odb::dbNet* net) override;
   void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
   void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbSWireAddSBox(odb::dbSBox* box) override;
+  void inDbSWireRemoveSBox(odb::dbSBox* box) override;
+  void inDbSWirePreDestroySBoxes(odb::dbSWire* wire) override;
+  void inDbObstructionCreate(odb::dbObstruction* obstruction) override;
+  void inDbObstructionDestroy(odb::dbObstruction* obstruction) override;
+  void inDbBlockageCreate(odb::dbBlockage* blockage) override;
+  void inDbBlockageDestroy(odb::dbBlockage* blockage) override;
+  void inDbBPinAddBox(odb::dbBox* box) override;
+  void inDbBPinRemoveBox(odb::dbBox* box) override;
+  void inDbBPinDestroy(odb::dbBPin* pin) override;
+  void inDbBTermPostConnect(odb::dbBTerm* term) override;
+  void inDbBTermPostDisConnect(odb::dbBTerm* term, odb::dbNet* net) override;
+  void inDbBTermDestroy(odb::dbBTerm* term) override;
 
  private:
+  void addDirtyRegion(odb::dbInst* inst);
+  void addDirtyRegion(odb::dbNet* net);
+  void addDirtyRegion(const odb::Rect& region);
+
   TritonRoute* router_;
 };
 }  // namespace drt
@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -50,6 +51,7 @@
 #include "odb/dbId.h"
 #include "odb/dbShape.h"
 #include "odb/dbTypes.h"
+#include "odb/lefout.h"
 #include "omp.h"
 #include "pa/AbstractPAGraphics.h"
 #include "pa/FlexPA.h"
@@ -359,6 +361,7 @@ void TritonRoute::resetDb(const char* file_name)
     logger_->error(
         DRT, 9954, "odb file {} is invalid: {}", file_name, f.what());
   }
+  clearDRCBaseline();
   design_ = std::make_unique<frDesign>(logger_, router_cfg_.get());
   initDesign();
   if (!db_->getChip()->getBlock()->getAccessPoints().empty()) {
@@ -370,6 +373,7 @@ void TritonRoute::resetDb(const char* file_name)
 
 void TritonRoute::clearDesign()
 {
+  clearDRCBaseline();
   design_ = std::make_unique<frDesign>(logger_, router_cfg_.get());
 }
 
@@ -856,6 +860,25 @@ void TritonRoute::reportConstraints()
   getDesign()->getTech()->printAllConstraints(logger_);
 }
 
+void TritonRoute::startTrace()
+{
+  ProfileTracer::start();
+}
+
+void TritonRoute::stopTrace()
+{
+  ProfileTracer::stop();
+}
+
+void TritonRoute::writeTrace(const std::string& file_name)
+{
+  const int num_events = ProfileTracer::write(file_name);
+  if (num_events < 0) {
+    logger_->error(DRT, 357, "Cannot write trace file {}.", file_name);
+  }
+  logger_->info(DRT, 358, "Wrote {} trace events to {}.", num_events, file_name);
+}
+
 bool TritonRoute::writeGlobals(const std::string& name)
 {
   std::ofstream file(name);
@@ -1040,6 +1063,7 @@ int TritonRoute::main()
     if (debug_->debugPA) {
       pa_->setDebug(graphics_factory_->makeUniquePAGraphics());
     }
+    initPinAccessCache();
     if (pa_thread) {
       pa_thread->join();
     }
@@ -1110,11 +1134,24 @@ void TritonRoute::pinAccess(const std::vector<odb::dbInst*>& target_insts)
     pa_->setDistributed(dist_ip_, dist_port_, shared_volume_, cloud_sz_);
     dist_pool_->join();
   }
+  initPinAccessCache();
   pa_->main();
   io::Writer writer(getDesign(), logger_);
   writer.updateDb(db_, router_cfg_.get(), true);
 }
 
+// Cached pin access is only reused with the technology it was computed for.
+void TritonRoute::initPinAccessCache()
+{
+  if (router_cfg_->PA_CACHE_FILE.empty()) {
+    return;
+  }
+  std::ostringstream tech_lef;
+  odb::lefout writer(logger_, tech_lef);
+  writer.writeTech(db_->getTech());
+  pa_->setCacheFile(router_cfg_->PA_CACHE_FILE, tech_lef.str());
+}
+
 void TritonRoute::deleteInstancePAData(frInst* inst, bool delete_inst)
 {
   if (pa_) {
@@ -1163,22 +1200,51 @@ void TritonRoute::fixMaxSpacing(int num_threads)
 }
 
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
-                                const odb::Rect& requiredDrcBox)
-{
-  std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
-  auto size = 7;
-  auto offset = 0;
-  auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
+                                const odb::Rect& requiredDrcBox,
+                                const std::vector<odb::Rect>* dirty_regions)
+{
+  // The die is cut into tiles of size x size gcells.  Each tile is checked
+  // by its own FlexGCWorker over the tile bloated by DRCSAFEDIST so that
+  // violations straddling a tile boundary are seen by both neighbours.
+  const int size = 7;
+  auto block = design_->getTopBlock();
+  auto gCellPatterns = block->getGCellPatterns();
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
-  for (int i = offset; i < (int) xgp.getCount(); i += size) {
-    for (int j = offset; j < (int) ygp.getCount(); j += size) {
-      odb::Rect routeBox1
-          = design_->getTopBlock()->getGCellBox(odb::Point(i, j));
+  const int num_tiles_x = ((int) xgp.getCount() + size - 1) / size;
+  const int num_tiles_y = ((int) ygp.getCount() + size - 1) / size;
+
+  // Only tiles whose drcBox can see a changed region need re-checking.
+  std::vector<bool> dirty_tiles;
+  if (dirty_regions != nullptr) {
+    dirty_tiles.resize(num_tiles_x * num_tiles_y, false);
+    for (const odb::Rect& region : *dirty_regions) {
+      odb::Rect box;
+      region.bloat(2 * router_cfg_->DRCSAFEDIST, box);
+      const odb::Point ll = block->getGCellIdx(box.ll());
+      const odb::Point ur = block->getGCellIdx(box.ur());
+      for (int x = ll.x() / size; x <= ur.x() / size; x++) {
+        for (int y = ll.y() / size; y <= ur.y() / size; y++) {
+          dirty_tiles[x * num_tiles_y + y] = true;
+        }
+      }
+    }
+  }
+
+  std::vector<odb::Rect> drcBoxes;
+  std::vector<odb::Rect> extBoxes;
+  for (int tile_x = 0; tile_x < num_tiles_x; tile_x++) {
+    for (int tile_y = 0; tile_y < num_tiles_y; tile_y++) {
+      if (dirty_regions != nullptr
+          && !dirty_tiles[tile_x * num_tiles_y + tile_y]) {
+        continue;
+      }
+      const int i = tile_x * size;
+      const int j = tile_y * size;
+      odb::Rect routeBox1 = block->getGCellBox(odb::Point(i, j));
       const int max_i = std::min((int) xgp.getCount() - 1, i + size - 1);
-      const int max_j = std::min((int) ygp.getCount(), j + size - 1);
-      odb::Rect routeBox2
-          = design_->getTopBlock()->getGCellBox(odb::Point(max_i, max_j));
+      const int max_j = std::min((int) ygp.getCount() - 1, j + size - 1);
+      odb::Rect routeBox2 = block->getGCellBox(odb::Point(max_i, max_j));
       odb::Rect routeBox(routeBox1.xMin(),
                          routeBox1.yMin(),
                          routeBox2.xMax(),
@@ -1190,42 +1256,48 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
       if (!drcBox.intersects(requiredDrcBox)) {
         continue;
       }
-      auto gcWorker = std::make_unique<FlexGCWorker>(
-          design_->getTech(), logger_, router_cfg_.get());
-      gcWorker->setDrcBox(drcBox);
-      gcWorker->setExtBox(extBox);
-      if (workersBatches.back().size() >= router_cfg_->BATCHSIZE) {
-        workersBatches.emplace_back();
-      }
-      workersBatches.back().push_back(std::move(gcWorker));
+      drcBoxes.push_back(drcBox);
+      extBoxes.push_back(extBox);
     }
   }
-  std::map<MarkerId, frMarker*> mapMarkers;
+  debugPrint(logger_,
+             DRT,
+             "check_drc",
+             1,
+             "Checking {} of {} tiles.",
+             drcBoxes.size(),
+             num_tiles_x * num_tiles_y);
+
+  // Workers are created and freed inside the loop so at most one worker
+  // per thread is alive at any time.
+  std::vector<std::vector<std::unique_ptr<frMarker>>> tileMarkers(
+      drcBoxes.size());
   omp_set_num_threads(router_cfg_->MAX_THREADS);
-  for (auto& workers : workersBatches) {
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < workers.size(); i++) {  // NOLINT
-      workers[i]->init(design_.get());
-      workers[i]->main();
+  for (int i = 0; i < drcBoxes.size(); i++) {  // NOLINT
+    FlexGCWorker gcWorker(design_->getTech(), logger_, router_cfg_.get());
+    gcWorker.setDrcBox(drcBoxes[i]);
+    gcWorker.setExtBox(extBoxes[i]);
+    gcWorker.init(design_.get());
+    gcWorker.main();
+    for (auto& marker : gcWorker.getMarkers()) {
+      if (marker->getBBox().intersects(requiredDrcBox)) {
+        tileMarkers[i].push_back(std::make_unique<frMarker>(*marker));
+      }
     }
-    for (const auto& worker : workers) {
-      for (auto& marker : worker->getMarkers()) {
-        odb::Rect bbox = marker->getBBox();
-        if (!bbox.intersects(requiredDrcBox)) {
-          continue;
-        }
-        auto layerNum = marker->getLayerNum();
-        auto con = marker->getConstraint();
-        if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
-            != mapMarkers.end()) {
-          continue;
-        }
-        markers.push_back(std::make_unique<frMarker>(*marker));
-        mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
-            = markers.back().get();
+  }
+
+  std::set<MarkerId> markerIds;
+  for (auto& tile : tileMarkers) {
+    for (auto& marker : tile) {
+      MarkerId id{marker->getBBox(),
+                  marker->getLayerNum(),
+                  marker->getConstraint(),
+                  marker->getSrcs()};
+      if (markerIds.insert(std::move(id)).second) {
+        markers.push_back(std::move(marker));
       }
     }
-    workers.clear();
   }
 }
 
@@ -1235,6 +1307,7 @@ void TritonRoute::checkDRC(const char* filename,
                            int x2,
                            int y2,
                            const std::string& marker_name,
+                           bool incremental,
                            int num_threads)
 {
   router_cfg_->GC_IGNORE_PDN_LAYER_NUM = -1;
@@ -1256,8 +1329,71 @@ void TritonRoute::checkDRC(const char* filename,
     requiredDrcBox = design_->getTopBlock()->getBBox();
   }
   frList<std::unique_ptr<frMarker>> markers;
-  getDRCMarkers(markers, requiredDrcBox);
+  if (incremental && drc_baseline_ && drc_box_ == requiredDrcBox) {
+    // Markers in the changed regions are recomputed from the re-checked
+    // tiles; everything else is taken from the previous run.
+    std::vector<odb::Rect> affected;
+    affected.reserve(drc_dirty_regions_.size());
+    for (const odb::Rect& region : drc_dirty_regions_) {
+      odb::Rect box;
+      region.bloat(router_cfg_->DRCSAFEDIST, box);
+      affected.push_back(box);
+    }
+    auto intersectsAffected = [&affected](const odb::Rect& bbox) {
+      return std::any_of(
+          affected.begin(), affected.end(), [&bbox](const odb::Rect& box) {
+            return box.intersects(bbox);
+          });
+    };
+    getDRCMarkers(markers, requiredDrcBox, &drc_dirty_regions_);
+    markers.remove_if([&intersectsAffected](const auto& marker) {
+      return !intersectsAffected(marker->getBBox());
+    });
+    const int num_rechecked = markers.size();
+    for (const auto& marker : drc_markers_) {
+      if (!intersectsAffected(marker->getBBox())) {
+        markers.push_back(std::make_unique<frMarker>(*marker));
+      }
+    }
+    logger_->info(DRT,
+                  359,
+                  "Incremental DRC re-checked {} changed regions, found {} "
+                  "markers there and kept {} unchanged markers.",
+                  drc_dirty_regions_.size(),
+                  num_rechecked,
+                  markers.size() - num_rechecked);
+  } else {
+    if (incremental) {
+      logger_->info(DRT,
+                    360,
+                    "No previous DRC results for this region, running a "
+                    "full check.");
+    }
+    getDRCMarkers(markers, requiredDrcBox);
+  }
   reportDRC(filename, markers, marker_name, requiredDrcBox);
+
+  drc_markers_.clear();
+  for (const auto& marker : markers) {
+    drc_markers_.push_back(std::make_unique<frMarker>(*marker));
+  }
+  drc_box_ = requiredDrcBox;
+  drc_baseline_ = true;
+  drc_dirty_regions_.clear();
+}
+
+void TritonRoute::addDRCDirtyRegion(const odb::Rect& region)
+{
+  if (drc_baseline_) {
+    drc_dirty_regions_.push_back(region);
+  }
+}
+
+void TritonRoute::clearDRCBaseline()
+{
+  drc_markers_.clear();
+  drc_dirty_regions_.clear();
+  drc_baseline_ = false;
 }
 
 void TritonRoute::addUserSelectedVia(const std::string& viaName)
@@ -1328,6 +1464,9 @@ void TritonRoute::setParams(const ParamStruct& params)
   router_cfg_->SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   router_cfg_->REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
   router_cfg_->MAX_THREADS = params.num_threads;
+  router_cfg_->PA_CACHE_FILE = params.pinAccessCacheFile;
+  router_cfg_->MAZE_LANDMARKS = params.mazeLandmarks;
+  router_cfg_->NUM_WORKER_PROCS = params.workerProcesses;
 }
 
 void TritonRoute::addWorkerResults(
@@ -66,7 +66,10 @@ void detailed_route_cmd(const char* outputMazeFile,
                         int minAccessPoints,
                         bool saveGuideUpdates,
                         const char* repairPDNLayerName,
-                        int drcReportIterStep)
+                        int drcReportIterStep,
+                        const char* pinAccessCacheFile,
+                        int mazeLandmarks,
+                        int workerProcesses)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
@@ -89,7 +92,10 @@ void detailed_route_cmd(const char* outputMazeFile,
                     minAccessPoints,
                     saveGuideUpdates,
                     repairPDNLayerName,
-                    num_threads});
+                    num_threads,
+                    pinAccessCacheFile,
+                    mazeLandmarks,
+                    workerProcesses});
   router->main();
   router->setDistributed(false);
 }
@@ -99,7 +105,8 @@ void pin_access_cmd(const char* dbProcessNode,
                     int verbose,
                     int minAccessPoints,
                     const char* viaInPinBottomLayer,
-                    const char* viaInPinTopLayer)
+                    const char* viaInPinTopLayer,
+                    const char* pinAccessCacheFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   drt::ParamStruct params;
@@ -109,6 +116,7 @@ void pin_access_cmd(const char* dbProcessNode,
   params.minAccessPoints = minAccessPoints;
   params.viaInPinBottomLayer = viaInPinBottomLayer;
   params.viaInPinTopLayer = viaInPinTopLayer;
+  params.pinAccessCacheFile = pinAccessCacheFile;
   params.num_threads = ord::OpenRoad::openRoad()->getThreadCount();
   router->setParams(params);
   router->pinAccess();
@@ -121,6 +129,20 @@ void report_constraints()
   router->reportConstraints();
 }
 
+void detailed_route_trace_cmd(bool start, bool stop, const char* file_name)
+{
+  auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
+  if (start) {
+    router->startTrace();
+  }
+  if (file_name[0] != '\0') {
+    router->writeTrace(file_name);
+  }
+  if (stop) {
+    router->stopTrace();
+  }
+}
+
 void
 set_detailed_route_debug_cmd(const char* net_name,
                              const char* pin_name,
@@ -211,11 +233,11 @@ void step_end()
   router->endFR();
 }
 
-void check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2, const char* marker_name)
+void check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2, const char* marker_name, bool incremental)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
-  router->checkDRC(drc_file, x1, y1, x2, y2, marker_name, num_threads);
+  router->checkDRC(drc_file, x1, y1, x2, y2, marker_name, incremental, num_threads);
 }
 
 std::vector<int>
@@ -25,9 +25,12 @@ sta::define_cmd_args "detailed_route" {
     [-clean_patches]
     [-no_pin_access]
     [-min_access_points count]
+    [-pin_access_cache filename]
     [-save_guide_updates]
     [-repair_pdn_vias layer]
     [-single_step_dr]
+    [-maze_landmarks count]
+    [-worker_processes count]
 }
 
 proc detailed_route { args } {
@@ -36,7 +39,8 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -via_access_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -pin_access_cache -maze_landmarks -worker_processes} \
     flags {-disable_via_gen -distributed -clean_patches -no_pin_access \
            -single_step_dr -save_guide_updates}
   sta::check_argc_eq0 "detailed_route" $args
@@ -161,12 +165,30 @@ proc detailed_route { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
+  if { [info exists keys(-maze_landmarks)] } {
+    sta::check_cardinal "-maze_landmarks" $keys(-maze_landmarks)
+    set maze_landmarks $keys(-maze_landmarks)
+  } else {
+    set maze_landmarks 0
+  }
+  if { [info exists keys(-worker_processes)] } {
+    sta::check_cardinal "-worker_processes" $keys(-worker_processes)
+    set worker_processes $keys(-worker_processes)
+  } else {
+    set worker_processes 0
+  }
   drt::detailed_route_cmd $output_maze $output_drc \
     $output_guide_coverage $db_process_node $enable_via_gen $droute_end_iter \
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $via_access_layer $or_seed $or_k $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $pin_access_cache $maze_landmarks $worker_processes
 }
 
 proc detailed_route_num_drvs { args } {
@@ -271,6 +293,7 @@ sta::define_cmd_args "pin_access" {
     [-via_in_pin_bottom_layer layer]
     [-via_in_pin_top_layer layer]
     [-min_access_points count]
+    [-pin_access_cache filename]
     [-verbose level]
     [-distributed]
     [-remote_host rhost]
@@ -282,7 +305,8 @@ proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
     keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
           -min_access_points -remote_host -remote_port -shared_volume -cloud_size \
-          -via_access_layer -via_in_pin_bottom_layer -via_in_pin_top_layer} \
+          -via_access_layer -via_in_pin_bottom_layer -via_in_pin_top_layer \
+          -pin_access_cache} \
     flags {-distributed}
   sta::check_argc_eq0 "pin_access" $args
   if { [info exists keys(-db_process_node)] } {
@@ -325,6 +349,11 @@ proc pin_access { args } {
   } else {
     set via_in_pin_top_layer ""
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   if { [info exists flags(-distributed)] } {
     if { [info exists keys(-remote_host)] } {
       set rhost $keys(-remote_host)
@@ -350,7 +379,7 @@ proc pin_access { args } {
   }
   drt::pin_access_cmd $db_process_node \
     $via_access_layer $verbose $min_access_points \
-    $via_in_pin_bottom_layer $via_in_pin_top_layer
+    $via_in_pin_bottom_layer $via_in_pin_top_layer $pin_access_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
@@ -444,6 +473,25 @@ proc detailed_route_worker_debug { args } {
     $fixed_shape_cost $marker_decay $ripup_mode $follow_guide
 }
 
+sta::define_cmd_args "detailed_route_trace" {
+    [-start]
+    [-stop]
+    [-output_file filename]
+} ;# checker off
+
+proc detailed_route_trace { args } {
+  sta::parse_key_args "detailed_route_trace" args \
+    keys {-output_file} \
+    flags {-start -stop} ;# checker off
+  sta::check_argc_eq0 "detailed_route_trace" $args
+  set output_file ""
+  if { [info exists keys(-output_file)] } {
+    set output_file $keys(-output_file)
+  }
+  drt::detailed_route_trace_cmd [info exists flags(-start)] \
+    [info exists flags(-stop)] $output_file
+}
+
 proc detailed_route_set_default_via { args } {
   sta::check_argc_eq1 "detailed_route_set_default_via" $args
   drt::detailed_route_set_default_via $args
@@ -468,11 +516,12 @@ sta::define_hidden_cmd_args "check_drc" {
     [-box box]
     [-output_file filename]
     [-marker_name name]
+    [-incremental]
 } ;# checker off
 proc check_drc { args } {
   sta::parse_key_args "check_drc" args \
     keys { -box -output_file -marker_name } \
-    flags {} ;# checker off
+    flags { -incremental } ;# checker off
   sta::check_argc_eq0 "check_drc" $args
   set box { 0 0 0 0 }
   if { [info exists keys(-box)] } {
@@ -491,7 +540,8 @@ proc check_drc { args } {
   } else {
     utl::error DRT 613 "-output_file is required for check_drc command"
   }
-  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 $marker_name
+  set incremental [info exists flags(-incremental)]
+  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 $marker_name $incremental
 }
 
 proc fix_max_spacing { args } {
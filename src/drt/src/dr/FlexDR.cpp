@@ -3,27 +3,39 @@
 
 #include "dr/FlexDR.h"
 
+#include <signal.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cerrno>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <ios>
 #include <iostream>
 #include <iterator>
+#include <latch>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <set>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -58,6 +70,7 @@
 #include "utl/Logger.h"
 #include "utl/Progress.h"
 #include "utl/ScopedTemporaryFile.h"
+#include "utl/ThreadPool.h"
 #include "utl/exception.h"
 
 using odb::dbTechLayerType;
@@ -219,6 +232,10 @@ int FlexDRWorker::main(frDesign* design)
                     routeBox_.xMax() * micronPerDBU,
                     routeBox_.yMax() * micronPerDBU);
   }
+  std::shared_lock<std::shared_mutex> design_lock;
+  if (design_mutex_) {
+    design_lock = std::shared_lock<std::shared_mutex>(*design_mutex_);
+  }
   initMarkers(design);
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
     skipRouting_ = true;
@@ -273,12 +290,17 @@ int FlexDRWorker::main(frDesign* design)
   if (!skipRouting_) {
     init(design);
   }
+  if (design_lock.owns_lock()) {
+    design_lock.unlock();
+  }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (!skipRouting_) {
     route_queue();
   }
   high_resolution_clock::time_point t2 = high_resolution_clock::now();
   const int num_markers = getNumMarkers();
+  const std::size_t grid_graph_bytes = gridGraph_.getMemoryUsage();
+  const uint64_t num_expansions = gridGraph_.getNumExpansions();
   cleanup();
   high_resolution_clock::time_point t3 = high_resolution_clock::now();
 
@@ -308,6 +330,18 @@ int FlexDRWorker::main(frDesign* design)
              duration_cast<duration<double>>(t3 - t0).count(),
              getInitNumMarkers(),
              num_markers);
+  debugPrint(logger_,
+             DRT,
+             "grid_graph",
+             1,
+             "worker ({:.3f} {:.3f}) grid graph {:.1f} KB, {} expansions "
+             "in {:.3f}s ({:.0f}/s)",
+             routeBox_.xMin() * micronPerDBU,
+             routeBox_.yMin() * micronPerDBU,
+             grid_graph_bytes / 1024.0,
+             num_expansions,
+             time_span1.count(),
+             num_expansions / std::max(time_span1.count(), 1e-9));
 
   return 0;
 }
@@ -728,6 +762,155 @@ void FlexDR::processWorkersBatch(
   exception.rethrow();
 }
 
+namespace {
+// Returns, for each worker, the later workers whose ext boxes intersect its
+// ext box. Boxes are binned into buckets at least as large as any box so
+// that each box is compared only against its neighbors.
+std::vector<std::vector<int>> getWorkerDependents(
+    const std::vector<odb::Rect>& ext_boxes)
+{
+  odb::Rect bbox;
+  bbox.mergeInit();
+  int bucket_size = 1;
+  for (const odb::Rect& box : ext_boxes) {
+    bbox.merge(box);
+    bucket_size = std::max({bucket_size, box.dx(), box.dy()});
+  }
+  const int num_x = bbox.dx() / bucket_size + 1;
+  const int num_y = bbox.dy() / bucket_size + 1;
+  std::vector<std::vector<int>> buckets(num_x * num_y);
+  std::vector<std::vector<int>> dependents(ext_boxes.size());
+  std::vector<int> last_seen(ext_boxes.size(), -1);
+  for (int i = 0; i < ext_boxes.size(); i++) {
+    const odb::Rect& box = ext_boxes[i];
+    const int x_lo = (box.xMin() - bbox.xMin()) / bucket_size;
+    const int x_hi = (box.xMax() - bbox.xMin()) / bucket_size;
+    const int y_lo = (box.yMin() - bbox.yMin()) / bucket_size;
+    const int y_hi = (box.yMax() - bbox.yMin()) / bucket_size;
+    for (int x = x_lo; x <= x_hi; x++) {
+      for (int y = y_lo; y <= y_hi; y++) {
+        std::vector<int>& bucket = buckets[x * num_y + y];
+        for (const int j : bucket) {
+          if (last_seen[j] != i && ext_boxes[j].intersects(box)) {
+            last_seen[j] = i;
+            dependents[j].push_back(i);
+          }
+        }
+        bucket.push_back(i);
+      }
+    }
+  }
+  return dependents;
+}
+}  // namespace
+
+// Runs the workers without batch barriers. A worker starts as soon as every
+// earlier worker whose ext box intersects its own has ended, so overlapping
+// workers see each other's results in the same order as with the checkerboard
+// batches while independent workers route concurrently. The routed workers
+// are committed in checkerboard order so that the shapes and markers are added
+// to the design in the same order as by the batches.
+void FlexDR::processWorkersGraph(
+    std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+    IterationProgress& iter_prog)
+{
+  ProfileTask profile("DR:worker_graph");
+  const int num_markers = getDesign()->getTopBlock()->getNumMarkers();
+
+  std::vector<odb::Rect> ext_boxes;
+  ext_boxes.reserve(workers.size());
+  for (const auto& worker : workers) {
+    ext_boxes.push_back(worker->getExtBox());
+  }
+  const std::vector<std::vector<int>> dependents
+      = getWorkerDependents(ext_boxes);
+  std::vector<std::atomic<int>> num_pending(workers.size());
+  for (const auto& worker_dependents : dependents) {
+    for (const int dependent : worker_dependents) {
+      num_pending[dependent]++;
+    }
+  }
+
+  // end() updates the design under the exclusive lock while other workers
+  // only read it under the shared lock during their initialization.
+  std::shared_mutex design_mutex;
+  ThreadException exception;
+  std::latch done(workers.size());
+  utl::ThreadPool pool(router_cfg_->MAX_THREADS);
+
+  // Commit state, guarded by commit_mutex. One thread at a time commits
+  // the routed prefix of the workers; the others only mark theirs routed.
+  std::mutex commit_mutex;
+  std::vector<char> routed(workers.size(), 0);
+  int next_commit = 0;
+  bool committing = false;
+
+  std::function<void(int)> run_worker;
+  auto commit_worker = [&](const int worker_idx) {
+    auto& worker = workers[worker_idx];
+    // After a failure the remaining workers are drained without committing.
+    if (!exception.hasException()) {
+      try {
+        ProfileTask profile("DRW:end");
+        std::unique_lock<std::shared_mutex> lock(design_mutex);
+        if (worker->end(getDesign())) {
+          numWorkUnits_ += 1;
+        }
+        if (worker->isCongested()) {
+          increaseClipsize_ = true;
+        }
+      } catch (...) {
+        exception.capture();
+      }
+      if (router_cfg_->VERBOSE > 0) {
+        printIterationProgress(logger_, iter_prog, num_markers);
+      }
+    }
+    worker.reset();
+    for (const int dependent : dependents[worker_idx]) {
+      if (--num_pending[dependent] == 0) {
+        pool.submit([&run_worker, dependent]() { run_worker(dependent); });
+      }
+    }
+    done.count_down();
+  };
+  run_worker = [&](const int worker_idx) {
+    if (!exception.hasException()) {
+      try {
+        auto& worker = workers[worker_idx];
+        worker->setDesignMutex(&design_mutex);
+        worker->main(getDesign());
+        worker->endPrepare();
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    std::unique_lock<std::mutex> lock(commit_mutex);
+    routed[worker_idx] = 1;
+    if (committing) {
+      return;
+    }
+    committing = true;
+    while (next_commit < workers.size() && routed[next_commit]) {
+      const int commit_idx = next_commit++;
+      lock.unlock();
+      commit_worker(commit_idx);
+      lock.lock();
+    }
+    committing = false;
+  };
+  for (int i = 0; i < workers.size(); i++) {
+    if (num_pending[i] == 0) {
+      pool.submit([&run_worker, i]() { run_worker(i); });
+    }
+  }
+  ProfileTask wait_profile("DR:wait_workers");
+  done.wait();
+  wait_profile.done();
+  exception.rethrow();
+  workers.clear();
+}
+
 void FlexDR::processWorkersBatchDistributed(
     std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
     int& version,
@@ -793,10 +976,207 @@ void FlexDR::processWorkersBatchDistributed(
   }
 }
 
+namespace {
+// Writes all of data to fd, retrying on short writes and interrupts.
+bool writeAll(int fd, const char* data, std::size_t size)
+{
+  while (size > 0) {
+    const ssize_t written = write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+// Reads fd until end of file.
+bool readAll(int fd, std::string& buffer)
+{
+  char chunk[1 << 16];
+  while (true) {
+    const ssize_t num_read = read(fd, chunk, sizeof(chunk));
+    if (num_read == 0) {
+      return true;
+    }
+    if (num_read < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    buffer.append(chunk, num_read);
+  }
+}
+}  // namespace
+
+// Routes the batch in up to NUM_WORKER_PROCS forked processes on this host.
+// Each child inherits the design as of this batch through fork, so nothing
+// but the routed workers has to be sent back.  The workers are serialized
+// the same way as for distributed routing and streamed over a pipe per
+// child as (index, size, bytes) records.
+void FlexDR::processWorkersBatchForked(
+    std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
+    IterationProgress& iter_prog)
+{
+  if (workers_batch.empty()) {
+    return;
+  }
+  ProfileTask task("DR:fork_batch");
+  const int num_markers = getDesign()->getTopBlock()->getNumMarkers();
+  const int batch_size = workers_batch.size();
+  const int num_procs = std::min(router_cfg_->NUM_WORKER_PROCS, batch_size);
+  // Unflushed output would otherwise be printed again by every child.
+  std::cout.flush();
+  std::fflush(stdout);
+  std::fflush(stderr);
+  std::vector<pid_t> pids;
+  std::vector<int> read_fds;
+  // Kills and reaps the children started so far before reporting an error.
+  auto abort_children = [&pids, &read_fds] {
+    for (const int fd : read_fds) {
+      close(fd);
+    }
+    for (const pid_t pid : pids) {
+      kill(pid, SIGKILL);
+    }
+    for (const pid_t pid : pids) {
+      while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {
+      }
+    }
+  };
+  for (int proc = 0; proc < num_procs; proc++) {
+    int pipe_fds[2];
+    if (pipe(pipe_fds) != 0) {
+      const int error = errno;
+      abort_children();
+      logger_->error(DRT, 363, "Cannot create pipe: {}.", strerror(error));
+    }
+    const pid_t pid = fork();
+    if (pid < 0) {
+      const int error = errno;
+      close(pipe_fds[0]);
+      close(pipe_fds[1]);
+      abort_children();
+      logger_->error(
+          DRT, 364, "Cannot fork DR worker process: {}.", strerror(error));
+    }
+    if (pid == 0) {
+      // Child: only this thread exists here, so route serially.
+      close(pipe_fds[0]);
+      for (const int fd : read_fds) {
+        close(fd);
+      }
+      int status = 0;
+      try {
+        for (int i = proc; i < batch_size; i += num_procs) {
+          workers_batch[i]->main(getDesign());
+          std::string workerStr;
+          serializeWorker(workers_batch[i].get(), workerStr);
+          const int32_t idx = i;
+          const uint64_t size = workerStr.size();
+          if (!writeAll(pipe_fds[1], (const char*) &idx, sizeof(idx))
+              || !writeAll(pipe_fds[1], (const char*) &size, sizeof(size))
+              || !writeAll(pipe_fds[1], workerStr.data(), size)) {
+            status = 1;
+            break;
+          }
+        }
+      } catch (...) {
+        status = 1;
+      }
+      close(pipe_fds[1]);
+      std::cout.flush();
+      std::fflush(stdout);
+      _exit(status);
+    }
+    close(pipe_fds[1]);
+    pids.push_back(pid);
+    read_fds.push_back(pipe_fds[0]);
+  }
+
+  // One reader per child so that no child blocks on a full pipe.
+  std::vector<std::string> results(num_procs);
+  std::vector<char> read_ok(num_procs, false);
+  {
+    std::vector<std::thread> readers;
+    readers.reserve(num_procs);
+    for (int proc = 0; proc < num_procs; proc++) {
+      readers.emplace_back([&, proc] {
+        read_ok[proc] = readAll(read_fds[proc], results[proc]);
+        close(read_fds[proc]);
+      });
+    }
+    for (auto& reader : readers) {
+      reader.join();
+    }
+  }
+  // Reap every child before reporting a failed one.
+  pid_t failed_pid = 0;
+  for (int proc = 0; proc < num_procs; proc++) {
+    int status = 0;
+    while (waitpid(pids[proc], &status, 0) < 0 && errno == EINTR) {
+    }
+    if (!read_ok[proc] || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      failed_pid = pids[proc];
+    }
+  }
+  if (failed_pid != 0) {
+    logger_->error(DRT, 361, "DR worker process {} failed.", failed_pid);
+  }
+
+  std::vector<std::pair<int, std::string_view>> workers;
+  workers.reserve(batch_size);
+  for (const std::string& result : results) {
+    std::size_t pos = 0;
+    while (pos + sizeof(int32_t) + sizeof(uint64_t) <= result.size()) {
+      int32_t idx;
+      uint64_t size;
+      std::memcpy(&idx, result.data() + pos, sizeof(idx));
+      pos += sizeof(idx);
+      std::memcpy(&size, result.data() + pos, sizeof(size));
+      pos += sizeof(size);
+      workers.emplace_back(idx, std::string_view(result).substr(pos, size));
+      pos += size;
+    }
+  }
+  if (workers.size() != batch_size) {
+    logger_->error(DRT,
+                   362,
+                   "Received {} of {} workers from DR worker processes.",
+                   workers.size(),
+                   batch_size);
+  }
+  {
+    ProfileTask task("DR:fork_deserialize");
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < workers.size(); i++) {  // NOLINT
+      FlexDRWorker* worker = workers_batch.at(workers[i].first).get();
+      deserializeWorker(worker, design_, std::string(workers[i].second));
+      worker->setLocal();
+#pragma omp critical
+      {
+        if (router_cfg_->VERBOSE > 0) {
+          printIterationProgress(logger_, iter_prog, num_markers);
+        }
+      }
+    }
+  }
+}
+
 void FlexDR::endWorkersBatch(
     std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch)
 {
   ProfileTask profile("DR:end_batch");
+  // Building the objects to add only reads each worker's own results
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int) workers_batch.size(); i++) {  // NOLINT
+    workers_batch[i]->endPrepare();
+  }
   // single thread
   for (auto& worker : workers_batch) {
     if (worker->end(getDesign())) {
@@ -1317,6 +1697,26 @@ void FlexDR::optimizationFlow(const SearchRepairArgs& args,
   int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
+  const bool forked
+      = !dist_on_ && !graphics_ && router_cfg_->NUM_WORKER_PROCS > 1;
+  if (!dist_on_ && !graphics_ && !forked) {
+    // The checkerboard order only decides which of two overlapping workers
+    // goes first; the workers are not separated by batch barriers.
+    std::vector<std::unique_ptr<FlexDRWorker>> ordered_workers;
+    ordered_workers.reserve(iter_prog.total_num_workers);
+    for (auto& workerBatch : workers) {
+      for (auto& workersInBatch : workerBatch) {
+        for (auto& worker : workersInBatch) {
+          ordered_workers.push_back(std::move(worker));
+        }
+      }
+    }
+    processWorkersGraph(ordered_workers, iter_prog);
+    if (!iter_) {
+      removeGCell2BoundaryPin();
+    }
+    return;
+  }
   // parallel execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
@@ -1328,6 +1728,8 @@ void FlexDR::optimizationFlow(const SearchRepairArgs& args,
         ProfileTask profile(batch_name.c_str());
         if (dist_on_) {
           processWorkersBatchDistributed(workersInBatch, version, iter_prog);
+        } else if (forked) {
+          processWorkersBatchForked(workersInBatch, iter_prog);
         } else {
           processWorkersBatch(workersInBatch, iter_prog);
         }
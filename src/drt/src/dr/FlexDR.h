@@ -10,6 +10,7 @@
 #include <memory>
 #include <queue>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -198,10 +199,16 @@ class FlexDR
       std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
       IterationProgress& iter_prog);
 
+  void processWorkersGraph(
+      std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+      IterationProgress& iter_prog);
   void processWorkersBatchDistributed(
       std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
       int& version,
       IterationProgress& iter_prog);
+  void processWorkersBatchForked(
+      std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
+      IterationProgress& iter_prog);
   odb::Rect getDRVBBox(const odb::Rect& drv_rect) const;
   void stubbornTilesFlow(const SearchRepairArgs& args,
                          IterationProgress& iter_prog);
@@ -420,6 +427,10 @@ class FlexDRWorker
   }
   void setViaData(FlexDRViaData* viaData) { via_data_ = viaData; }
   void setWorkerId(const int id) { worker_id_ = id; }
+  // Held shared while main() reads the design so that the end() of a
+  // non-overlapping worker, run under the exclusive lock, can overlap with
+  // this worker's routing.
+  void setDesignMutex(std::shared_mutex* mutex) { design_mutex_ = mutex; }
   // getters
   frTechObject* getTech() const { return design_->getTech(); }
   void getRouteBox(odb::Rect& boxIn) const { boxIn = routeBox_; }
@@ -471,6 +482,10 @@ class FlexDRWorker
   void writeUpdates(const std::string& file_name);
   void updateDesign(frDesign* design);
   std::string reloadedMain();
+  // Builds the objects that end() adds to the design from the worker's own
+  // results. It does not access the design, so it may run concurrently with
+  // the end() of other workers. end() calls it if it has not been called.
+  void endPrepare();
   bool end(frDesign* design);
 
   utl::Logger* getLogger() { return logger_; }
@@ -500,6 +515,10 @@ class FlexDRWorker
     dist_dir_ = dir;
   }
 
+  // Deserializing marks a worker as distributed; results routed by a local
+  // worker process are committed like those of an in-process worker.
+  void setLocal() { dist_on_ = false; }
+
   void setSharedVolume(const std::string& vol) { dist_dir_ = vol; }
 
   std::vector<Point3D> getSpecialAccessAPs() const { return specialAccessAPs_; }
@@ -536,6 +555,13 @@ class FlexDRWorker
     {
     }
   };
+  // A design object built by endPrepare() from a best route conn fig
+  struct EndConnFig
+  {
+    drConnFig* dr_fig;
+    std::unique_ptr<frShape> shape;  // path seg or patch wire
+    std::unique_ptr<frVia> via;
+  };
   frDesign* design_{nullptr};
   utl::Logger* logger_{nullptr};
   RouterConfiguration* router_cfg_{nullptr};
@@ -590,6 +616,13 @@ class FlexDRWorker
   bool isCongested_{false};
   bool save_updates_{false};
   int worker_id_{0};
+  std::shared_mutex* design_mutex_{nullptr};
+
+  // staged by endPrepare
+  bool end_prepared_{false};
+  frOrderedIdSet<frNet*> end_mod_nets_;
+  std::vector<std::vector<EndConnFig>> end_conn_figs_;  // indexed as nets_
+  std::vector<std::unique_ptr<frMarker>> end_markers_;
 
   // hellpers
   bool isRoutePatchWire(const frPatchWire* pwire) const;
@@ -1088,6 +1121,7 @@ class FlexDRWorker
   // end
   void cleanup();
   void identifyCongestionLevel();
+  bool isEndSkipped() const;
   void endGetModNets(frOrderedIdSet<frNet*>& modNets);
   void endRemoveNets(
       frDesign* design,
@@ -1104,9 +1138,15 @@ class FlexDRWorker
       frDesign* design,
       frOrderedIdMap<frNet*, std::set<std::pair<odb::Point, frLayerNum>>>&
           boundPts);
-  void endAddNets_pathSeg(frDesign* design, drPathSeg* pathSeg);
-  void endAddNets_via(frDesign* design, drVia* via);
-  void endAddNets_patchWire(frDesign* design, drPatchWire* pwire);
+  void endAddNets_pathSeg(frDesign* design,
+                          drPathSeg* pathSeg,
+                          std::unique_ptr<frShape> uShape);
+  void endAddNets_via(frDesign* design,
+                      drVia* via,
+                      std::unique_ptr<frVia> uVia);
+  void endAddNets_patchWire(frDesign* design,
+                            drPatchWire* pwire,
+                            std::unique_ptr<frShape> uShape);
   void endAddNets_merge(frDesign* design,
                         frNet* net,
                         std::set<std::pair<odb::Point, frLayerNum>>& boundPts);
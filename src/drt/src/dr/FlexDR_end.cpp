@@ -28,9 +28,7 @@ void FlexDRWorker::endGetModNets(frOrderedIdSet<frNet*>& modNets)
 {
   for (auto& net : nets_) {
     if (net->isModified()) {
-      auto fr_net = net->getFrNet();
-      fr_net->setModified(true);
-      modNets.insert(fr_net);
+      modNets.insert(net->getFrNet());
     }
   }
   // change modified flag to true if another subnet get routed
@@ -308,10 +306,11 @@ void FlexDRWorker::endRemoveNets(
   }
 }
 
-void FlexDRWorker::endAddNets_pathSeg(frDesign* design, drPathSeg* pathSeg)
+void FlexDRWorker::endAddNets_pathSeg(frDesign* design,
+                                      drPathSeg* pathSeg,
+                                      std::unique_ptr<frShape> uShape)
 {
   auto net = pathSeg->getNet()->getFrNet();
-  std::unique_ptr<frShape> uShape = std::make_unique<frPathSeg>(*pathSeg);
   auto rptr = uShape.get();
   net->addShape(std::move(uShape));
   design->getRegionQuery()->addDRObj(rptr);
@@ -323,10 +322,11 @@ void FlexDRWorker::endAddNets_pathSeg(frDesign* design, drPathSeg* pathSeg)
   }
 }
 
-void FlexDRWorker::endAddNets_via(frDesign* design, drVia* via)
+void FlexDRWorker::endAddNets_via(frDesign* design,
+                                  drVia* via,
+                                  std::unique_ptr<frVia> uVia)
 {
   auto net = via->getNet()->getFrNet();
-  std::unique_ptr<frVia> uVia = std::make_unique<frVia>(*via);
   auto rptr = uVia.get();
   net->addVia(std::move(uVia));
   design->getRegionQuery()->addDRObj(rptr);
@@ -338,10 +338,11 @@ void FlexDRWorker::endAddNets_via(frDesign* design, drVia* via)
   }
 }
 
-void FlexDRWorker::endAddNets_patchWire(frDesign* design, drPatchWire* pwire)
+void FlexDRWorker::endAddNets_patchWire(frDesign* design,
+                                        drPatchWire* pwire,
+                                        std::unique_ptr<frShape> uShape)
 {
   auto net = pwire->getNet()->getFrNet();
-  std::unique_ptr<frShape> uShape = std::make_unique<frPatchWire>(*pwire);
   auto rptr = uShape.get();
   net->addPatchWire(std::move(uShape));
   design->getRegionQuery()->addDRObj(rptr);
@@ -599,18 +600,20 @@ void FlexDRWorker::endAddNets(
     frOrderedIdMap<frNet*, std::set<std::pair<odb::Point, frLayerNum>>>&
         boundPts)
 {
-  for (auto& net : nets_) {
+  for (int i = 0; i < nets_.size(); i++) {
+    auto& net = nets_[i];
     if (!net->isModified()) {
       continue;
     }
-    for (auto& connFig : net->getBestRouteConnFigs()) {
+    for (auto& [connFig, shape, via] : end_conn_figs_[i]) {
       if (connFig->typeId() == drcPathSeg) {
         endAddNets_pathSeg(
-            design, static_cast<drPathSeg*>(connFig.get()) /*, cutSegs[fNet]*/);
+            design, static_cast<drPathSeg*>(connFig), std::move(shape));
       } else if (connFig->typeId() == drcVia) {
-        endAddNets_via(design, static_cast<drVia*>(connFig.get()));
+        endAddNets_via(design, static_cast<drVia*>(connFig), std::move(via));
       } else if (connFig->typeId() == drcPatchWire) {
-        endAddNets_patchWire(design, static_cast<drPatchWire*>(connFig.get()));
+        endAddNets_patchWire(
+            design, static_cast<drPatchWire*>(connFig), std::move(shape));
       } else {
         std::cout << "Error: endAddNets unsupported type\n";
       }
@@ -645,20 +648,17 @@ void FlexDRWorker::endAddMarkers(frDesign* design)
 {
   auto regionQuery = design->getRegionQuery();
   auto topBlock = design->getTopBlock();
-  // for (auto &m: getMarkers()) {
-  for (auto& m : getBestMarkers()) {
-    if (getDrcBox().intersects(m.getBBox())) {
-      auto uptr = std::make_unique<frMarker>(m);
-      auto ptr = uptr.get();
-      regionQuery->addMarker(ptr);
-      topBlock->addMarker(std::move(uptr));
-      if (save_updates_) {
-        drUpdate update(drUpdate::ADD_SHAPE);
-        update.setMarker(*ptr);
-        design_->addUpdate(update);
-      }
+  for (auto& uptr : end_markers_) {
+    auto ptr = uptr.get();
+    regionQuery->addMarker(ptr);
+    topBlock->addMarker(std::move(uptr));
+    if (save_updates_) {
+      drUpdate update(drUpdate::ADD_SHAPE);
+      update.setMarker(*ptr);
+      design_->addUpdate(update);
     }
   }
+  end_markers_.clear();
 }
 
 void FlexDRWorker::cleanup()
@@ -679,15 +679,15 @@ void FlexDRWorker::cleanup()
   specialAccessAPs_.clear();
 }
 
-bool FlexDRWorker::end(frDesign* design)
+bool FlexDRWorker::isEndSkipped() const
 {
   if (skipRouting_) {
-    return false;
+    return true;
   }
   // skip if current clip does not have input DRCs
   // ripupMode = 0 must have enableDRC = true in previous iteration
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
-    return false;
+    return true;
     // do not write back if current clip is worse than input
   }
   if ((getRipupMode() == RipUpMode::DRC || getRipupMode() == RipUpMode::NEARDRC
@@ -695,22 +695,69 @@ bool FlexDRWorker::end(frDesign* design)
       && getBestNumMarkers() > getInitNumMarkers()) {
     // cout <<"skip clip with #init/final = " <<getInitNumMarkers() <<"/"
     // <<getNumMarkers() <<endl;
-    return false;
+    return true;
   }
   if (getDRIter() && getRipupMode() == RipUpMode::ALL
       && getBestNumMarkers() > 5 * getInitNumMarkers()) {
+    return true;
+  }
+  return false;
+}
+
+void FlexDRWorker::endPrepare()
+{
+  end_prepared_ = true;
+  if (isEndSkipped()) {
+    return;
+  }
+  endGetModNets(end_mod_nets_);
+  end_conn_figs_.resize(nets_.size());
+  for (int i = 0; i < nets_.size(); i++) {
+    auto& net = nets_[i];
+    if (!net->isModified()) {
+      continue;
+    }
+    for (auto& connFig : net->getBestRouteConnFigs()) {
+      EndConnFig fig{connFig.get()};
+      if (connFig->typeId() == drcPathSeg) {
+        fig.shape = std::make_unique<frPathSeg>(
+            *static_cast<drPathSeg*>(connFig.get()));
+      } else if (connFig->typeId() == drcVia) {
+        fig.via = std::make_unique<frVia>(*static_cast<drVia*>(connFig.get()));
+      } else if (connFig->typeId() == drcPatchWire) {
+        fig.shape = std::make_unique<frPatchWire>(
+            *static_cast<drPatchWire*>(connFig.get()));
+      }
+      end_conn_figs_[i].push_back(std::move(fig));
+    }
+  }
+  for (auto& m : getBestMarkers()) {
+    if (getDrcBox().intersects(m.getBBox())) {
+      end_markers_.push_back(std::make_unique<frMarker>(m));
+    }
+  }
+}
+
+bool FlexDRWorker::end(frDesign* design)
+{
+  if (!end_prepared_) {
+    endPrepare();
+  }
+  if (isEndSkipped()) {
     return false;
   }
   save_updates_ = dist_on_;
-  frOrderedIdSet<frNet*> modNets;
-  endGetModNets(modNets);
+  for (frNet* net : end_mod_nets_) {
+    net->setModified(true);
+  }
   // get lock
   frOrderedIdMap<frNet*, std::set<std::pair<odb::Point, frLayerNum>>> boundPts;
-  endRemoveNets(design, modNets, boundPts);
+  endRemoveNets(design, end_mod_nets_, boundPts);
   endAddNets(design, boundPts);  // if two subnets have diff isModified()
                                  // status, then should always write back
   endRemoveMarkers(design);
   endAddMarkers(design);
+  end_conn_figs_.clear();
   // release lock
   return true;
 }
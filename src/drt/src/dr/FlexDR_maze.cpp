@@ -3260,14 +3260,24 @@ bool FlexDRWorker::routeNet(drNet* net, std::vector<FlexMazeIdx>& paths)
     auto nextPin = routeNet_getNextDst(
         ccMazeIdx1, ccMazeIdx2, mazeIdx2unConnPins, pinTaperBoxes);
     path.clear();
-    if (gridGraph_.search(connComps,
-                          nextPin,
-                          path,
-                          ccMazeIdx1,
-                          ccMazeIdx2,
-                          centerPt,
-                          mazeIdx2TaperBox,
-                          route_with_jumpers)) {
+    const uint64_t prevNumExpansions = gridGraph_.getNumExpansions();
+    const bool found = gridGraph_.search(connComps,
+                                         nextPin,
+                                         path,
+                                         ccMazeIdx1,
+                                         ccMazeIdx2,
+                                         centerPt,
+                                         mazeIdx2TaperBox,
+                                         route_with_jumpers);
+    debugPrint(logger_,
+               DRT,
+               "grid_graph",
+               2,
+               "net {} pin {}: {} expansions",
+               net->getFrNet()->getName(),
+               nextPin->getName(),
+               gridGraph_.getNumExpansions() - prevNumExpansions);
+    if (found) {
       routeNet_postAstarUpdate(
           path, connComps, unConnPins, mazeIdx2unConnPins, isFirstConn);
       routeNet_postAstarWritePath(
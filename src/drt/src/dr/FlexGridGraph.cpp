@@ -92,20 +92,15 @@ void FlexGridGraph::initGrids(const frLayerCoordTrackPatternMap& xMap,
 
   nodes_.clear();
   nodes_.resize(capacity, Node());
-  // new
-  prevDirs_.clear();
-  srcs_.clear();
-  dsts_.clear();
-
-  prevDirs_.resize(static_cast<std::size_t>(capacity) * 3, false);
-  srcs_.resize(capacity, false);
-  dsts_.resize(capacity, false);
-  guides_.clear();
-  if (followGuide) {
-    guides_.resize(capacity, false);
-  } else {
-    guides_.resize(capacity, true);
+  if (!followGuide) {
+    for (Node& node : nodes_) {
+      node.hasGuide = true;
+    }
   }
+  costs_.clear();
+  costs_.resize(capacity, NodeCost());
+  ndrCosts_.clear();
+  numExpansions_ = 0;
 }
 
 bool FlexGridGraph::outOfDieVia(frMIdx x,
@@ -454,6 +449,7 @@ void FlexGridGraph::init(const frDesign* design,
   initGrids(xMap, yMap, zMap, followGuide);  // buildGridGraph
   initEdges(
       design, xMap, yMap, zMap, routeBBox, initDR);  // add edges and edgeCost
+  initLandmarks(router_cfg_->MAZE_LANDMARKS);
   ap_locs_.clear();
 }
 
@@ -510,24 +506,32 @@ void FlexGridGraph::initTracks(
 
 void FlexGridGraph::resetStatus()
 {
-  resetSrc();
-  resetDst();
-  resetPrevNodeDir();
+  for (Node& node : nodes_) {
+    node.isSrc = false;
+    node.isDst = false;
+    node.prevDir = static_cast<frUInt4>(frDirEnum::UNKNOWN);
+  }
 }
 
 void FlexGridGraph::resetSrc()
 {
-  srcs_.assign(srcs_.size(), false);
+  for (Node& node : nodes_) {
+    node.isSrc = false;
+  }
 }
 
 void FlexGridGraph::resetDst()
 {
-  dsts_.assign(dsts_.size(), false);
+  for (Node& node : nodes_) {
+    node.isDst = false;
+  }
 }
 
 void FlexGridGraph::resetPrevNodeDir()
 {
-  prevDirs_.assign(prevDirs_.size(), false);
+  for (Node& node : nodes_) {
+    node.prevDir = static_cast<frUInt4>(frDirEnum::UNKNOWN);
+  }
 }
 
 // print the grid graph with edge and vertex for debug purpose
@@ -5,10 +5,12 @@
 
 #include <algorithm>
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <set>
 #include <string>
@@ -293,32 +295,34 @@ class FlexGridGraph
     frUInt4 sol = 0;
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      const NodeCost& cost = costs_[idx];
       if (dir == frDirEnum::W || dir == frDirEnum::E) {
         if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarHorz,
-                         node.fixedShapeCostPlanarHorzNDR);
+          sol = std::max(cost.fixedShapeCostPlanarHorz,
+                         getNDRCost(idx).fixedShapeCostPlanarHorzNDR);
         } else {
-          sol = node.fixedShapeCostPlanarHorz;
+          sol = cost.fixedShapeCostPlanarHorz;
         }
       } else {
         if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarVert,
-                         node.fixedShapeCostPlanarVertNDR);
+          sol = std::max(cost.fixedShapeCostPlanarVert,
+                         getNDRCost(idx).fixedShapeCostPlanarVertNDR);
         } else {
-          sol = node.fixedShapeCostPlanarVert;
+          sol = cost.fixedShapeCostPlanarVert;
         }
       }
     } else {
       correct(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
-      if (isOverrideShapeCost(x, y, z, dir)) {
+      const auto idx = getIdx(x, y, z);
+      if (nodes_[idx].overrideShapeCostVia) {
         sol = 0;
       } else {
         if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostVia, node.fixedShapeCostViaNDR);
+          sol = std::max(costs_[idx].fixedShapeCostVia,
+                         getNDRCost(idx).fixedShapeCostViaNDR);
         } else {
-          sol = node.fixedShapeCostVia;
+          sol = costs_[idx].fixedShapeCostVia;
         }
       }
     }
@@ -353,19 +357,19 @@ class FlexGridGraph
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
       if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostPlanar,
-                       nodes_[idx].routeShapeCostPlanarNDR);
+        sol = std::max(costs_[idx].routeShapeCostPlanar,
+                       getNDRCost(idx).routeShapeCostPlanarNDR);
       } else {
-        sol = nodes_[idx].routeShapeCostPlanar;
+        sol = costs_[idx].routeShapeCostPlanar;
       }
     } else {
       correct(x, y, z, dir);
       auto idx = getIdx(x, y, z);
       if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostVia,
-                       nodes_[idx].routeShapeCostViaNDR);
+        sol = std::max(costs_[idx].routeShapeCostVia,
+                       getNDRCost(idx).routeShapeCostViaNDR);
       } else {
-        sol = nodes_[idx].routeShapeCostVia;
+        sol = costs_[idx].routeShapeCostVia;
       }
     }
     return (sol);
@@ -386,11 +390,11 @@ class FlexGridGraph
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostPlanar;
+      sol += costs_[idx].markerCostPlanar;
     } else {
       correct(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostVia;
+      sol += costs_[idx].markerCostVia;
     }
     return (sol);
   }
@@ -545,72 +549,80 @@ class FlexGridGraph
   }
   void addRouteShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.routeShapeCostPlanarNDR = addToByte(node.routeShapeCostPlanarNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.routeShapeCostPlanarNDR
+          = addToByte(ndr_cost.routeShapeCostPlanarNDR, 1);
     } else {
-      node.routeShapeCostPlanar = addToByte(node.routeShapeCostPlanar, 1);
+      auto& cost = costs_[idx];
+      cost.routeShapeCostPlanar = addToByte(cost.routeShapeCostPlanar, 1);
     }
   }
   void addRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.routeShapeCostViaNDR = addToByte(node.routeShapeCostViaNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.routeShapeCostViaNDR
+          = addToByte(ndr_cost.routeShapeCostViaNDR, 1);
     } else {
-      node.routeShapeCostVia = addToByte(node.routeShapeCostVia, 1);
+      auto& cost = costs_[idx];
+      cost.routeShapeCostVia = addToByte(cost.routeShapeCostVia, 1);
     }
   }
   void subRouteShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.routeShapeCostPlanarNDR
-          = subFromByte(node.routeShapeCostPlanarNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.routeShapeCostPlanarNDR
+          = subFromByte(ndr_cost.routeShapeCostPlanarNDR, 1);
     } else {
-      node.routeShapeCostPlanar = subFromByte(node.routeShapeCostPlanar, 1);
+      auto& cost = costs_[idx];
+      cost.routeShapeCostPlanar = subFromByte(cost.routeShapeCostPlanar, 1);
     }
   }
   void subRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.routeShapeCostViaNDR = subFromByte(node.routeShapeCostViaNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.routeShapeCostViaNDR
+          = subFromByte(ndr_cost.routeShapeCostViaNDR, 1);
     } else {
-      node.routeShapeCostVia = subFromByte(node.routeShapeCostVia, 1);
+      auto& cost = costs_[idx];
+      cost.routeShapeCostVia = subFromByte(cost.routeShapeCostVia, 1);
     }
   }
   void resetRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.routeShapeCostViaNDR = 0;
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.routeShapeCostViaNDR = 0;
     } else {
-      node.routeShapeCostVia = 0;
+      auto& cost = costs_[idx];
+      cost.routeShapeCostVia = 0;
     }
   }
   void addMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+    auto& cost = costs_[getIdx(x, y, z)];
+    cost.markerCostPlanar = addToByte(cost.markerCostPlanar, 10);
   }
   void addMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostVia = addToByte(node.markerCostVia, 10);
+    auto& cost = costs_[getIdx(x, y, z)];
+    cost.markerCostVia = addToByte(cost.markerCostVia, 10);
   }
   void addMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
     correct(x, y, z, dir);
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      NodeCost& cost = costs_[getIdx(x, y, z)];
       switch (dir) {
         case frDirEnum::E:
         case frDirEnum::N:
-          node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+          cost.markerCostPlanar = addToByte(cost.markerCostPlanar, 10);
           break;
         case frDirEnum::U:
-          node.markerCostVia = addToByte(node.markerCostVia, 10);
+          cost.markerCostVia = addToByte(cost.markerCostVia, 10);
           break;
         default:;
       }
@@ -619,41 +631,41 @@ class FlexGridGraph
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    NodeCost& cost = costs_[idx];
+    int currCost = cost.markerCostPlanar;
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    cost.markerCostPlanar = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    NodeCost& cost = costs_[idx];
+    int currCost = cost.markerCostVia;
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    cost.markerCostVia = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    NodeCost& cost = costs_[idx];
+    int currCost = cost.markerCostPlanar;
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    cost.markerCostPlanar = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    NodeCost& cost = costs_[idx];
+    int currCost = cost.markerCostVia;
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    cost.markerCostVia = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir, float d)
@@ -661,25 +673,25 @@ class FlexGridGraph
     correct(x, y, z, dir);
     int currCost = 0;
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      NodeCost& cost = costs_[getIdx(x, y, z)];
       switch (dir) {
         case frDirEnum::E:
-          currCost = node.markerCostPlanar;
+          currCost = cost.markerCostPlanar;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          cost.markerCostPlanar = currCost;
           break;
         case frDirEnum::N:
-          currCost = node.markerCostPlanar;
+          currCost = cost.markerCostPlanar;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          cost.markerCostPlanar = currCost;
           break;
         case frDirEnum::U:
-          currCost = node.markerCostVia;
+          currCost = cost.markerCostVia;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostVia = currCost;
+          cost.markerCostVia = currCost;
           break;
         default:;
       }
@@ -688,91 +700,106 @@ class FlexGridGraph
   }
   void addFixedShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostPlanarHorzNDR
-          = addToByte(node.fixedShapeCostPlanarHorzNDR, 1);
-      node.fixedShapeCostPlanarVertNDR
-          = addToByte(node.fixedShapeCostPlanarVertNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostPlanarHorzNDR
+          = addToByte(ndr_cost.fixedShapeCostPlanarHorzNDR, 1);
+      ndr_cost.fixedShapeCostPlanarVertNDR
+          = addToByte(ndr_cost.fixedShapeCostPlanarVertNDR, 1);
     } else {
-      node.fixedShapeCostPlanarHorz
-          = addToByte(node.fixedShapeCostPlanarHorz, 1);
-      node.fixedShapeCostPlanarVert
-          = addToByte(node.fixedShapeCostPlanarVert, 1);
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostPlanarHorz
+          = addToByte(cost.fixedShapeCostPlanarHorz, 1);
+      cost.fixedShapeCostPlanarVert
+          = addToByte(cost.fixedShapeCostPlanarVert, 1);
     }
   }
   void setFixedShapeCostPlanarVert(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostPlanarVertNDR = c;
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostPlanarVertNDR = c;
     } else {
-      node.fixedShapeCostPlanarVert = c;
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostPlanarVert = c;
     }
   }
   void setFixedShapeCostPlanarHorz(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostPlanarHorzNDR = c;
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostPlanarHorzNDR = c;
     } else {
-      node.fixedShapeCostPlanarHorz = c;
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostPlanarHorz = c;
     }
   }
   void addFixedShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostViaNDR = addToByte(node.fixedShapeCostViaNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostViaNDR
+          = addToByte(ndr_cost.fixedShapeCostViaNDR, 1);
     } else {
-      node.fixedShapeCostVia = addToByte(node.fixedShapeCostVia, 1);
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostVia = addToByte(cost.fixedShapeCostVia, 1);
     }
   }
   void setFixedShapeCostVia(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostViaNDR = c;
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostViaNDR = c;
     } else {
-      node.fixedShapeCostVia = c;
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostVia = c;
     }
   }
   void subFixedShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostPlanarHorzNDR
-          = subFromByte(node.fixedShapeCostPlanarHorzNDR, 1);
-      node.fixedShapeCostPlanarVertNDR
-          = subFromByte(node.fixedShapeCostPlanarVertNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostPlanarHorzNDR
+          = subFromByte(ndr_cost.fixedShapeCostPlanarHorzNDR, 1);
+      ndr_cost.fixedShapeCostPlanarVertNDR
+          = subFromByte(ndr_cost.fixedShapeCostPlanarVertNDR, 1);
     } else {
-      node.fixedShapeCostPlanarHorz
-          = subFromByte(node.fixedShapeCostPlanarHorz, 1);
-      node.fixedShapeCostPlanarVert
-          = subFromByte(node.fixedShapeCostPlanarVert, 1);
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostPlanarHorz
+          = subFromByte(cost.fixedShapeCostPlanarHorz, 1);
+      cost.fixedShapeCostPlanarVert
+          = subFromByte(cost.fixedShapeCostPlanarVert, 1);
     }
   }
   void subFixedShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
     if (ndr) {
-      node.fixedShapeCostViaNDR = subFromByte(node.fixedShapeCostViaNDR, 1);
+      auto& ndr_cost = getNDRCost(idx);
+      ndr_cost.fixedShapeCostViaNDR
+          = subFromByte(ndr_cost.fixedShapeCostViaNDR, 1);
     } else {
-      node.fixedShapeCostVia = subFromByte(node.fixedShapeCostVia, 1);
+      auto& cost = costs_[idx];
+      cost.fixedShapeCostVia = subFromByte(cost.fixedShapeCostVia, 1);
     }
   }
 
   // unsafe access, no idx check
-  void setSrc(frMIdx x, frMIdx y, frMIdx z) { srcs_[getIdx(x, y, z)] = true; }
+  void setSrc(frMIdx x, frMIdx y, frMIdx z)
+  {
+    nodes_[getIdx(x, y, z)].isSrc = true;
+  }
   void setSrc(const FlexMazeIdx& mi)
   {
-    srcs_[getIdx(mi.x(), mi.y(), mi.z())] = true;
+    nodes_[getIdx(mi.x(), mi.y(), mi.z())].isSrc = true;
   }
   // unsafe access, no idx check
-  void setDst(frMIdx x, frMIdx y, frMIdx z) { dsts_[getIdx(x, y, z)] = true; }
+  void setDst(frMIdx x, frMIdx y, frMIdx z)
+  {
+    nodes_[getIdx(x, y, z)].isDst = true;
+  }
   void setDst(const FlexMazeIdx& mi)
   {
-    dsts_[getIdx(mi.x(), mi.y(), mi.z())] = true;
+    nodes_[getIdx(mi.x(), mi.y(), mi.z())].isDst = true;
   }
   // unsafe access
   void setSVia(frMIdx x, frMIdx y, frMIdx z)
@@ -840,20 +867,20 @@ class FlexGridGraph
   // unsafe access, no idx check
   void resetSrc(frMIdx x, frMIdx y, frMIdx z)
   {
-    srcs_[getIdx(x, y, z)] = false;
+    nodes_[getIdx(x, y, z)].isSrc = false;
   }
   void resetSrc(const FlexMazeIdx& mi)
   {
-    srcs_[getIdx(mi.x(), mi.y(), mi.z())] = false;
+    nodes_[getIdx(mi.x(), mi.y(), mi.z())].isSrc = false;
   }
   // unsafe access, no idx check
   void resetDst(frMIdx x, frMIdx y, frMIdx z)
   {
-    dsts_[getIdx(x, y, z)] = false;
+    nodes_[getIdx(x, y, z)].isDst = false;
   }
   void resetDst(const FlexMazeIdx& mi)
   {
-    dsts_[getIdx(mi.x(), mi.y(), mi.z())] = false;
+    nodes_[getIdx(mi.x(), mi.y(), mi.z())].isDst = false;
   }
   void resetGridCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
@@ -898,7 +925,7 @@ class FlexGridGraph
   {
     reverse(x, y, z, dir);
     auto idx = getIdx(x, y, z);
-    return guides_[idx];
+    return nodes_[idx].hasGuide;
   }
   // must be safe access because idx1 and idx2 may be invalid
   void setGuide(frMIdx x1, frMIdx y1, frMIdx x2, frMIdx y2, frMIdx z)
@@ -911,14 +938,14 @@ class FlexGridGraph
         for (int i = y1; i <= y2; i++) {
           auto idx1 = getIdx(x1, i, z);
           auto idx2 = getIdx(x2, i, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 1);
+          setGuide(idx1, idx2, true);
         }
         break;
       case odb::dbTechLayerDir::VERTICAL:
         for (int i = x1; i <= x2; i++) {
           auto idx1 = getIdx(i, y1, z);
           auto idx2 = getIdx(i, y2, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 1);
+          setGuide(idx1, idx2, true);
         }
         break;
       case odb::dbTechLayerDir::NONE:
@@ -936,14 +963,14 @@ class FlexGridGraph
         for (int i = y1; i <= y2; i++) {
           auto idx1 = getIdx(x1, i, z);
           auto idx2 = getIdx(x2, i, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 0);
+          setGuide(idx1, idx2, false);
         }
         break;
       case odb::dbTechLayerDir::VERTICAL:
         for (int i = x1; i <= x2; i++) {
           auto idx1 = getIdx(i, y1, z);
           auto idx2 = getIdx(i, y2, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 0);
+          setGuide(idx1, idx2, false);
         }
         break;
       case odb::dbTechLayerDir::NONE:
@@ -1002,18 +1029,31 @@ class FlexGridGraph
     return (isLayer1 ? (*halfViaEncArea_)[z].first
                      : (*halfViaEncArea_)[z].second);
   }
+  // Bytes held by the per grid point arrays.
+  std::size_t getMemoryUsage() const
+  {
+    std::size_t bytes = nodes_.capacity() * sizeof(Node)
+                        + costs_.capacity() * sizeof(NodeCost)
+                        + ndrCosts_.capacity() * sizeof(NodeNDRCost);
+    for (const auto& dists : landmarkDists_) {
+      bytes += dists.capacity() * sizeof(frCost);
+    }
+    return bytes;
+  }
+  // Grid points expanded by search() since init().
+  uint64_t getNumExpansions() const { return numExpansions_; }
   int nTracksX() { return xCoords_.size(); }
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
     nodes_.clear();
     nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    costs_.clear();
+    costs_.shrink_to_fit();
+    ndrCosts_.clear();
+    ndrCosts_.shrink_to_fit();
+    landmarkDists_.clear();
+    landmarkDists_.shrink_to_fit();
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -1031,6 +1071,7 @@ class FlexGridGraph
   void printNode(frMIdx x, frMIdx y, frMIdx z)
   {
     Node& n = nodes_[getIdx(x, y, z)];
+    NodeCost& c = costs_[getIdx(x, y, z)];
     std::cout << "\nNode ( " << x << " " << y << " " << z << " ) (idx) / "
               << " ( " << xCoords_[x] << " " << yCoords_[y] << " ) (coords)\n";
     std::cout << "hasEastEdge " << n.hasEastEdge << "\n";
@@ -1044,14 +1085,14 @@ class FlexGridGraph
     std::cout << "hasGridCostEast " << n.hasGridCostEast << "\n";
     std::cout << "hasGridCostNorth " << n.hasGridCostNorth << "\n";
     std::cout << "hasGridCostUp " << n.hasGridCostUp << "\n";
-    std::cout << "routeShapeCostPlanar " << n.routeShapeCostPlanar << "\n";
-    std::cout << "routeShapeCostVia " << n.routeShapeCostVia << "\n";
-    std::cout << "markerCostPlanar " << n.markerCostPlanar << "\n";
-    std::cout << "markerCostVia " << n.markerCostVia << "\n";
-    std::cout << "fixedShapeCostVia " << n.fixedShapeCostVia << "\n";
-    std::cout << "fixedShapeCostPlanarHorz " << n.fixedShapeCostPlanarHorz
+    std::cout << "routeShapeCostPlanar " << c.routeShapeCostPlanar << "\n";
+    std::cout << "routeShapeCostVia " << c.routeShapeCostVia << "\n";
+    std::cout << "markerCostPlanar " << c.markerCostPlanar << "\n";
+    std::cout << "markerCostVia " << c.markerCostVia << "\n";
+    std::cout << "fixedShapeCostVia " << c.fixedShapeCostVia << "\n";
+    std::cout << "fixedShapeCostPlanarHorz " << c.fixedShapeCostPlanarHorz
               << "\n";
-    std::cout << "fixedShapeCostPlanarVert " << n.fixedShapeCostPlanarVert
+    std::cout << "fixedShapeCostPlanarVert " << c.fixedShapeCostPlanarVert
               << "\n";
   }
 
@@ -1076,6 +1117,10 @@ class FlexGridGraph
   static constexpr int cost_bits = 8;
 #endif
 
+  // The grid is stored as parallel arrays indexed by getIdx().  The maze
+  // search mostly touches the edge and search state bits, so they are kept
+  // in a compact array apart from the costs that are only read when an edge
+  // is taken.
   struct Node
   {
     Node() { std::memset(this, 0, sizeof(Node)); }
@@ -1086,8 +1131,8 @@ class FlexGridGraph
     frUInt4 isBlockedEast : 1;
     frUInt4 isBlockedNorth : 1;
     frUInt4 isBlockedUp : 1;
-    frUInt4 unused1 : 1;
-    frUInt4 unused2 : 1;
+    frUInt4 isSrc : 1;
+    frUInt4 isDst : 1;
     // Byte 1
     frUInt4 hasSpecialVia : 1;
     frUInt4 overrideShapeCostVia : 1;
@@ -1098,38 +1143,53 @@ class FlexGridGraph
     frUInt4 hasApCostNorth : 1;
     frUInt4 hasApCostUp : 1;
     // Byte 2
+    frUInt4 prevDir : 3;  // frDirEnum
+    frUInt4 hasGuide : 1;
+    frUInt4 unused : 4;
+  };
+  static_assert(sizeof(Node) == 4);
+
+  struct NodeCost
+  {
+    NodeCost() { std::memset(this, 0, sizeof(NodeCost)); }
     frUInt4 routeShapeCostPlanar : cost_bits;
-    // Byte 3
     frUInt4 routeShapeCostVia : cost_bits;
-    // Byte4
     frUInt4 markerCostPlanar : cost_bits;
-    // Byte5
     frUInt4 markerCostVia : cost_bits;
-    // Byte6
     frUInt4 fixedShapeCostVia : cost_bits;
-    // Byte7
     frUInt4 fixedShapeCostPlanarHorz : cost_bits;
-    // Byte8
     frUInt4 fixedShapeCostPlanarVert : cost_bits;
-    // Byte9
+  };
+#ifndef DEBUG_DRT_UNDERFLOW
+  static_assert(sizeof(NodeCost) == 8);
+#endif
+
+  // Only needed when the worker has NDR nets.
+  struct NodeNDRCost
+  {
+    NodeNDRCost() { std::memset(this, 0, sizeof(NodeNDRCost)); }
     frUInt4 routeShapeCostPlanarNDR : cost_bits;
-    // Byte10
     frUInt4 routeShapeCostViaNDR : cost_bits;
-    // Byte 11
     frUInt4 fixedShapeCostViaNDR : cost_bits;
-    // Byte 12
     frUInt4 fixedShapeCostPlanarHorzNDR : cost_bits;
-    // Byte 13
     frUInt4 fixedShapeCostPlanarVertNDR : cost_bits;
   };
-#ifndef DEBUG_DRT_UNDERFLOW
-  static_assert(sizeof(Node) == 16);
-#endif
+
   frVector<Node> nodes_;
-  std::vector<bool> prevDirs_;
-  std::vector<bool> srcs_;
-  std::vector<bool> dsts_;
-  std::vector<bool> guides_;
+  frVector<NodeCost> costs_;
+  // Empty until the first NDR cost is written; reads then see zero costs.
+  frVector<NodeNDRCost> ndrCosts_;
+  uint64_t numExpansions_ = 0;
+
+  // ALT (A*, landmarks and the triangle inequality) search.  For each
+  // landmark this holds the edge length distance to every grid point.  Path
+  // costs only add penalties to edge lengths, so |d(L, dst) - d(L, v)| is a
+  // lower bound on the cost from v to dst.  Empty unless MAZE_LANDMARKS > 0.
+  static constexpr frCost kUnreachable = std::numeric_limits<frCost>::max();
+  std::vector<frVector<frCost>> landmarkDists_;
+  // Per landmark, the min and max distance to the access points of the pin
+  // being searched for.
+  std::vector<std::pair<frCost, frCost>> landmarkDstRanges_;
   frVector<frCoord> xCoords_;
   frVector<frCoord> yCoords_;
   frVector<frLayerNum> zCoords_;
@@ -1159,36 +1219,30 @@ class FlexGridGraph
   // unsafe access, no idx check
   void setPrevAstarNodeDir(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
-    auto baseIdx = static_cast<std::size_t>(getIdx(x, y, z)) * 3;
-    prevDirs_[baseIdx] = ((uint16_t) dir >> 2) & 1;
-    prevDirs_[baseIdx + 1] = ((uint16_t) dir >> 1) & 1;
-    prevDirs_[baseIdx + 2] = ((uint16_t) dir) & 1;
+    nodes_[getIdx(x, y, z)].prevDir = static_cast<frUInt4>(dir);
   }
 
   // unsafe access, no check
   frDirEnum getPrevAstarNodeDir(const FlexMazeIdx& idx) const
   {
-    auto baseIdx
-        = static_cast<std::size_t>(getIdx(idx.x(), idx.y(), idx.z())) * 3;
-    return (frDirEnum) (((uint16_t) (prevDirs_[baseIdx]) << 2)
-                        + ((uint16_t) (prevDirs_[baseIdx + 1]) << 1)
-                        + ((uint16_t) (prevDirs_[baseIdx + 2]) << 0));
+    return static_cast<frDirEnum>(
+        nodes_[getIdx(idx.x(), idx.y(), idx.z())].prevDir);
   }
 
   // unsafe access, no check
   bool isSrc(frMIdx x, frMIdx y, frMIdx z) const
   {
-    return srcs_[getIdx(x, y, z)];
+    return nodes_[getIdx(x, y, z)].isSrc;
   }
   // unsafe access, no check
   bool isDst(frMIdx x, frMIdx y, frMIdx z) const
   {
-    return dsts_[getIdx(x, y, z)];
+    return nodes_[getIdx(x, y, z)].isDst;
   }
   bool isDst(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir) const
   {
     getNextGrid(x, y, z, dir);
-    bool b = dsts_[getIdx(x, y, z)];
+    bool b = nodes_[getIdx(x, y, z)].isDst;
     getPrevGrid(x, y, z, dir);
     return b;
   }
@@ -1207,6 +1261,25 @@ class FlexGridGraph
     return zDirModifier + partialCoordinates;
   }
 
+  const NodeNDRCost& getNDRCost(frMIdx idx) const
+  {
+    static const NodeNDRCost no_cost;
+    return ndrCosts_.empty() ? no_cost : ndrCosts_[idx];
+  }
+  NodeNDRCost& getNDRCost(frMIdx idx)
+  {
+    if (ndrCosts_.empty()) {
+      ndrCosts_.resize(nodes_.size());
+    }
+    return ndrCosts_[idx];
+  }
+  void setGuide(frMIdx idx1, frMIdx idx2, bool value)
+  {
+    for (frMIdx idx = idx1; idx <= idx2; idx++) {
+      nodes_[idx].hasGuide = value;
+    }
+  }
+
   frUInt4 addToByte(frUInt4 augend, frUInt4 summand)
   {
     frUInt4 result = augend + summand;
@@ -1311,6 +1384,11 @@ class FlexGridGraph
                  const frLayerDirMap& zMap,
                  const odb::Rect& bbox,
                  bool initDR);
+  void initLandmarks(int numLandmarks);
+  void computeLandmarkDists(const FlexMazeIdx& landmark,
+                            frVector<frCost>& dists) const;
+  void setLandmarkDsts(drPin* pin);
+  frCost getLandmarkEstCost(frMIdx x, frMIdx y, frMIdx z) const;
   frCost getEstCost(const FlexMazeIdx& src,
                     const FlexMazeIdx& dstMazeIdx1,
                     const FlexMazeIdx& dstMazeIdx2,
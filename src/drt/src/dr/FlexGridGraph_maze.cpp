@@ -8,7 +8,9 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "db/drObj/drPin.h"
@@ -304,7 +306,119 @@ frCost FlexGridGraph::getEstCost(const FlexMazeIdx& src,
       forbiddenPenalty = 2 * ggDRCCost_ * edgeLength;
     }
   }
-  return (minCostX + minCostY + minCostZ + bendCnt + forbiddenPenalty);
+  frCost distCost = minCostX + minCostY + minCostZ;
+  if (!landmarkDists_.empty()) {
+    distCost = std::max(distCost, getLandmarkEstCost(gridX, gridY, gridZ));
+  }
+  return (distCost + bendCnt + forbiddenPenalty);
+}
+
+void FlexGridGraph::initLandmarks(const int numLandmarks)
+{
+  landmarkDists_.clear();
+  if (numLandmarks <= 0 || nodes_.empty()) {
+    return;
+  }
+  frMIdx xDim, yDim, zDim;
+  getDim(xDim, yDim, zDim);
+  // Farthest point selection: each landmark is the grid point farthest from
+  // the previous ones, starting from the point farthest from the center.
+  frVector<frCost> dists;
+  computeLandmarkDists({xDim / 2, yDim / 2, zDim / 2}, dists);
+  frVector<frCost> minDists(nodes_.size(), kUnreachable);
+  for (int i = 0; i < numLandmarks; i++) {
+    FlexMazeIdx landmark;
+    frCost farthest = 0;
+    for (frMIdx z = 0; z < zDim; z++) {
+      for (frMIdx y = 0; y < yDim; y++) {
+        for (frMIdx x = 0; x < xDim; x++) {
+          const auto idx = getIdx(x, y, z);
+          minDists[idx] = std::min(minDists[idx], dists[idx]);
+          if (minDists[idx] != kUnreachable && minDists[idx] > farthest) {
+            farthest = minDists[idx];
+            landmark.set(x, y, z);
+          }
+        }
+      }
+    }
+    if (farthest == 0) {
+      break;
+    }
+    computeLandmarkDists(landmark, dists);
+    landmarkDists_.push_back(dists);
+  }
+  landmarkDstRanges_.resize(landmarkDists_.size());
+}
+
+void FlexGridGraph::computeLandmarkDists(const FlexMazeIdx& landmark,
+                                         frVector<frCost>& dists) const
+{
+  dists.assign(nodes_.size(), kUnreachable);
+  using Entry = std::pair<frCost, FlexMazeIdx>;
+  auto cmp = [](const Entry& a, const Entry& b) { return a.first > b.first; };
+  std::priority_queue<Entry, std::vector<Entry>, decltype(cmp)> queue(cmp);
+  dists[getIdx(landmark.x(), landmark.y(), landmark.z())] = 0;
+  queue.emplace(0, landmark);
+  while (!queue.empty()) {
+    const auto [dist, currIdx] = queue.top();
+    queue.pop();
+    if (dist > dists[getIdx(currIdx.x(), currIdx.y(), currIdx.z())]) {
+      continue;
+    }
+    for (const auto dir : frDirEnumAll) {
+      frMIdx x = currIdx.x();
+      frMIdx y = currIdx.y();
+      frMIdx z = currIdx.z();
+      if (!hasEdge(x, y, z, dir)) {
+        continue;
+      }
+      const frCost nextDist = dist + getEdgeLength(x, y, z, dir);
+      getNextGrid(x, y, z, dir);
+      frCost& nextDists = dists[getIdx(x, y, z)];
+      if (nextDist < nextDists) {
+        nextDists = nextDist;
+        queue.emplace(nextDist, FlexMazeIdx(x, y, z));
+      }
+    }
+  }
+}
+
+void FlexGridGraph::setLandmarkDsts(drPin* pin)
+{
+  for (int i = 0; i < landmarkDists_.size(); i++) {
+    const auto& dists = landmarkDists_[i];
+    frCost dstMin = kUnreachable;
+    frCost dstMax = 0;
+    for (auto& ap : pin->getAccessPatterns()) {
+      const FlexMazeIdx& mi = ap->getMazeIdx();
+      const frCost dist = dists[getIdx(mi.x(), mi.y(), mi.z())];
+      if (dist != kUnreachable) {
+        dstMin = std::min(dstMin, dist);
+        dstMax = std::max(dstMax, dist);
+      }
+    }
+    landmarkDstRanges_[i] = {dstMin, dstMax};
+  }
+}
+
+frCost FlexGridGraph::getLandmarkEstCost(frMIdx x, frMIdx y, frMIdx z) const
+{
+  const auto idx = getIdx(x, y, z);
+  frCost sol = 0;
+  for (int i = 0; i < landmarkDists_.size(); i++) {
+    const auto [dstMin, dstMax] = landmarkDstRanges_[i];
+    const frCost dist = landmarkDists_[i][idx];
+    // skip landmarks that can't reach the point or any destination
+    if (dist == kUnreachable || dstMin > dstMax) {
+      continue;
+    }
+    if (dist < dstMin) {
+      sol = std::max(sol, dstMin - dist);
+    } else if (dist > dstMax) {
+      sol = std::max(sol, dist - dstMax);
+    }
+  }
+  return sol;
 }
 
 frDirEnum FlexGridGraph::getLastDir(
@@ -753,6 +867,10 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
                     std::max(dstMazeIdx2.z(), mi.z()));
   }
 
+  if (!landmarkDists_.empty()) {
+    setLandmarkDsts(nextPin);
+  }
+
   wavefront_.cleanup();
   // init wavefront
   odb::Point currPt;
@@ -796,6 +914,7 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
         != frDirEnum::UNKNOWN) {
       continue;
     }
+    numExpansions_++;
     if (graphics_) {
       graphics_->searchNode(this, currGrid);
     }
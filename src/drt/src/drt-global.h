@@ -50,6 +50,9 @@ struct RouterConfiguration
   bool DO_PA = true;
   bool SINGLE_STEP_DR = false;
   bool SAVE_GUIDE_UPDATES = false;
+  std::string PA_CACHE_FILE;
+  int MAZE_LANDMARKS = 0;  // 0 disables the landmark (ALT) heuristic
+  int NUM_WORKER_PROCS = 0;  // > 1 routes DR workers in forked processes
 
   std::string VIAINPIN_BOTTOMLAYER_NAME;
   std::string VIAINPIN_TOPLAYER_NAME;
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "frProfileTask.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace drt {
+
+namespace {
+
+struct TraceEvent
+{
+  char name[ProfileTracer::kMaxNameLength + 1];
+  int64_t start_us;
+  int64_t dur_us;
+};
+
+// Written only by its owning thread; read by write() once routing is done.
+struct TraceBuffer
+{
+  int tid;
+  std::vector<TraceEvent> events;
+  uint64_t count = 0;  // total events recorded since start()
+};
+
+std::mutex buffers_mutex;
+// Buffers outlive their thread so that its events can still be written.
+// A buffer whose thread exited is reused by the next new thread, so there
+// are never more buffers than threads recording at the same time.
+std::vector<std::unique_ptr<TraceBuffer>> buffers;
+std::vector<TraceBuffer*> free_buffers;
+std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+// Hands the thread's buffer back to free_buffers when the thread exits.
+class ThreadBuffer
+{
+ public:
+  ~ThreadBuffer()
+  {
+    if (buffer_ != nullptr) {
+      std::lock_guard<std::mutex> lock(buffers_mutex);
+      free_buffers.push_back(buffer_);
+    }
+  }
+
+  TraceBuffer* get()
+  {
+    if (buffer_ == nullptr) {
+      buffer_ = acquire();
+    }
+    return buffer_;
+  }
+
+ private:
+  static TraceBuffer* acquire()
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    if (!free_buffers.empty()) {
+      TraceBuffer* buffer = free_buffers.back();
+      free_buffers.pop_back();
+      return buffer;
+    }
+    auto buffer = std::make_unique<TraceBuffer>();
+    buffer->events.resize(ProfileTracer::kEventsPerThread);
+    buffer->tid = buffers.size();
+    buffers.push_back(std::move(buffer));
+    return buffers.back().get();
+  }
+
+  TraceBuffer* buffer_ = nullptr;
+};
+
+thread_local ThreadBuffer thread_buffer;
+
+void writeEscaped(std::ofstream& out, const char* str)
+{
+  for (; *str != '\0'; ++str) {
+    if (*str == '"' || *str == '\\') {
+      out << '\\';
+    }
+    out << *str;
+  }
+}
+
+}  // namespace
+
+std::atomic<bool> ProfileTracer::enabled_ = false;
+
+void ProfileTracer::start()
+{
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    for (auto& buffer : buffers) {
+      buffer->count = 0;
+    }
+    epoch = std::chrono::steady_clock::now();
+  }
+  enabled_.store(true, std::memory_order_release);
+}
+
+void ProfileTracer::stop()
+{
+  enabled_.store(false, std::memory_order_release);
+}
+
+int64_t ProfileTracer::now()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - epoch)
+      .count();
+}
+
+void ProfileTracer::record(const char* name, int64_t start_us, int64_t end_us)
+{
+  TraceBuffer* buffer = thread_buffer.get();
+  TraceEvent& event = buffer->events[buffer->count % kEventsPerThread];
+  std::memcpy(event.name, name, sizeof(event.name));
+  event.start_us = start_us;
+  event.dur_us = end_us - start_us;
+  ++buffer->count;
+}
+
+int ProfileTracer::write(const std::string& file_name)
+{
+  std::ofstream out(file_name);
+  if (!out) {
+    return -1;
+  }
+  std::lock_guard<std::mutex> lock(buffers_mutex);
+  int num_events = 0;
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (const auto& buffer : buffers) {
+    if (buffer->count == 0) {
+      continue;
+    }
+    if (num_events > 0) {
+      out << ",";
+    }
+    out << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+        << buffer->tid << ",\"args\":{\"name\":\"drt " << buffer->tid
+        << "\"}}";
+    // Oldest surviving event first once the ring has wrapped.
+    const uint64_t size = std::min<uint64_t>(buffer->count, kEventsPerThread);
+    for (uint64_t i = buffer->count - size; i < buffer->count; ++i) {
+      const TraceEvent& event = buffer->events[i % kEventsPerThread];
+      out << ",\n{\"name\":\"";
+      writeEscaped(out, event.name);
+      out << "\",\"ph\":\"X\",\"ts\":" << event.start_us
+          << ",\"dur\":" << event.dur_us << ",\"pid\":0,\"tid\":"
+          << buffer->tid << "}";
+      ++num_events;
+    }
+  }
+  out << "\n]}\n";
+  return out ? num_events : -1;
+}
+
+}  // namespace drt
@@ -3,16 +3,55 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
 #ifdef HAS_VTUNE
 #include <ittnotify.h>
 #endif
 
 namespace drt {
 
+// Built-in tracer for ProfileTask scopes.  While enabled, every finished
+// task is appended to a ring buffer owned by the thread that ran it.  A
+// thread's buffer is reused by later threads once it exits.  The
+// buffers can then be written as a Chrome trace (JSON) that loads in
+// ui.perfetto.dev or chrome://tracing.  When disabled a ProfileTask costs a
+// single relaxed atomic load.
+class ProfileTracer
+{
+ public:
+  // Longest task name kept in the trace; longer names are truncated.
+  static constexpr int kMaxNameLength = 47;
+  // Number of events kept per thread; the oldest are overwritten first.
+  static constexpr int kEventsPerThread = 1 << 15;
+
+  static bool isEnabled()
+  {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  // Discards previously recorded events and starts recording.  Must not be
+  // called while tasks are being recorded on other threads.
+  static void start();
+  static void stop();
+  // Writes the recorded events to file_name.  Returns the number of events
+  // written or -1 if the file can't be opened.
+  static int write(const std::string& file_name);
+
+  // Microseconds since start().
+  static int64_t now();
+  static void record(const char* name, int64_t start_us, int64_t end_us);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
 #ifdef HAS_VTUNE
 // This class make a VTune task in its scope (RAII).  This is useful
 // in VTune to see where the runtime is going with more domain specific
-// display.
+// display.  Tasks are also recorded by ProfileTracer when it is enabled.
 class ProfileTask
 {
  public:
@@ -21,12 +60,14 @@ class ProfileTask
     domain_ = __itt_domain_create("TritonRoute");
     name_ = __itt_string_handle_create(name);
     __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+    traceBegin(name);
   }
 
   ~ProfileTask()
   {
     if (!done_) {
       __itt_task_end(domain_);
+      traceEnd();
     }
   }
 
@@ -36,23 +77,58 @@ class ProfileTask
   {
     done_ = true;
     __itt_task_end(domain_);
+    traceEnd();
   }
 
  private:
   __itt_domain* domain_;
   __itt_string_handle* name_;
   bool done_;
-};
-
 #else
 
-// No-op version
+// Only records into ProfileTracer, and only when it is enabled.
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) {}
-  void done() {}
-};
+  ProfileTask(const char* name) { traceBegin(name); }
+
+  ~ProfileTask()
+  {
+    if (!done_) {
+      traceEnd();
+    }
+  }
+
+  void done()
+  {
+    done_ = true;
+    traceEnd();
+  }
+
+ private:
+  bool done_ = false;
 #endif
 
+  // The name is copied as callers may pass a temporary string.
+  void traceBegin(const char* name)
+  {
+    if (!ProfileTracer::isEnabled()) {
+      return;
+    }
+    std::strncpy(trace_name_, name, ProfileTracer::kMaxNameLength);
+    trace_name_[ProfileTracer::kMaxNameLength] = '\0';
+    trace_start_ = ProfileTracer::now();
+  }
+
+  void traceEnd()
+  {
+    if (trace_start_ >= 0 && ProfileTracer::isEnabled()) {
+      ProfileTracer::record(trace_name_, trace_start_, ProfileTracer::now());
+    }
+  }
+
+  char trace_name_[ProfileTracer::kMaxNameLength + 1];
+  int64_t trace_start_ = -1;
+};
+
 }  // namespace drt
@@ -4010,6 +4010,7 @@ void FlexGCWorker::Impl::modifyMarkers()
 
 int FlexGCWorker::Impl::main()
 {
+  ProfileTask profile("GC:main");
   // incremental updates
   pwires_.clear();
   clearMarkers();
@@ -167,6 +167,10 @@ void FlexPA::updateDirtyInsts()
 #pragma omp parallel for schedule(dynamic)
   for (auto& unique_class : dirty_unique_classes_vec) {
     initSkipInstTerm(unique_class);
+    if (applyCache(unique_class)) {
+      applyCachedPatterns(unique_class);
+      continue;
+    }
     auto candidate_inst = unique_class->getFirstInst();
     genInstAccessPoints(candidate_inst);
     revertAccessPoints(candidate_inst);
@@ -239,6 +243,22 @@ void FlexPA::applyPatternsFile(const char* file_path)
 void FlexPA::prep()
 {
   ProfileTask profile("PA:prep");
+  if (!cache_file_.empty()) {
+    readCache();
+    for (const auto& unique_class : unique_insts_.getUniqueClasses()) {
+      if (applyCache(unique_class.get())) {
+        cached_unique_classes_.insert(unique_class.get());
+      }
+    }
+    if (router_cfg_->VERBOSE > 0) {
+      logger_->info(DRT,
+                    353,
+                    "  Reused pin access of {} of {} unique instances from {}.",
+                    cached_unique_classes_.size(),
+                    unique_insts_.getUniqueClasses().size(),
+                    cache_file_);
+    }
+  }
   genAllAccessPoints();
   revertAccessPoints();
   if (isDistributed()) {
@@ -298,6 +318,9 @@ void FlexPA::prepPattern()
     unique_inst_patterns_[unique_class.get()]
         = std::vector<std::unique_ptr<FlexPinAccessPattern>>();
   }
+  for (UniqueClass* unique_class : cached_unique_classes_) {
+    applyCachedPatterns(unique_class);
+  }
 
   int cnt = 0;
 
@@ -309,7 +332,8 @@ void FlexPA::prepPattern()
       // only do for core and block cells
       // TODO the above comment says "block cells" but that's not what the code
       // does?
-      if (unique_class->getInsts().empty()) {
+      if (unique_class->getInsts().empty()
+          || cached_unique_classes_.contains(unique_class.get())) {
         continue;
       }
       auto candidate_inst = *unique_class->getInsts().begin();
@@ -458,6 +482,9 @@ int FlexPA::main()
 
   init();
   prep();
+  if (!cache_file_.empty()) {
+    writeCache();
+  }
 
   int std_cell_pin_cnt = 0;
   for (auto& inst : getDesign()->getTopBlock()->getInsts()) {
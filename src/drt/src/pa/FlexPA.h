@@ -108,6 +108,18 @@ class FlexPA
                       uint16_t rport,
                       const std::string& shared_vol,
                       int cloud_sz);
+  /**
+   * @brief Enables the on-disk pin access cache.
+   *
+   * Access points and access patterns of unique instances are read from
+   * file_name before pin access and written back after it.  Entries are only
+   * reused when the technology and the design context (tracks, vias and pin
+   * access settings) match the ones the cache was written with.
+   *
+   * @param file_name path of the cache file
+   * @param tech_lef the technology the router runs on, written as LEF
+   */
+  void setCacheFile(const std::string& file_name, const std::string& tech_lef);
 
   void deleteInst(frInst* inst);
   void addDirtyInst(frInst* inst);
@@ -157,6 +169,27 @@ class FlexPA
   std::string shared_vol_;
   int cloud_sz_ = -1;
 
+  // pin access cache
+  // access point of a cached unique class as {pin index in master, ap index}
+  using CachedAPRef = std::pair<int, int>;
+  struct CachedPattern
+  {
+    std::vector<CachedAPRef> aps;
+    CachedAPRef left{-1, -1};
+    CachedAPRef right{-1, -1};
+  };
+  struct CachedUniqueClass
+  {
+    // one entry per master pin, in term/pin order
+    std::vector<std::unique_ptr<frPinAccess>> pin_access;
+    std::vector<CachedPattern> patterns;
+  };
+  std::string cache_file_;
+  uint64_t cache_hash_ = 0;
+  std::map<std::string, CachedUniqueClass> cache_;
+  std::set<UniqueClass*> cached_unique_classes_;
+  frOrderedIdMap<frMaster*, uint64_t> master_hashes_;
+
   // helper functions
   frDesign* getDesign() const { return design_; }
   frTechObject* getTech() const { return design_->getTech(); }
@@ -182,6 +215,22 @@ class FlexPA
   // prep
   void prep();
 
+  // cache
+  uint64_t computeContextHash() const;
+  uint64_t computeMasterHash(frMaster* master) const;
+  std::string getCacheKey(UniqueClass* unique_class) const;
+  void readCache();
+  void writeCache();
+  /**
+   * @brief Copies the cached access points and patterns of a unique class to
+   * its pin access index.
+   *
+   * @return False if the unique class is not in the cache.
+   */
+  bool applyCache(UniqueClass* unique_class);
+  void applyCachedPatterns(UniqueClass* unique_class);
+  void addToCache(UniqueClass* unique_class);
+
   bool isStdCell(frInst* unique_inst);
   bool isStdCellTerm(frInstTerm* inst_term);
   bool isMacroCell(frInst* unique_inst);
@@ -1529,6 +1529,9 @@ void FlexPA::genAllAccessPoints()
 #pragma omp parallel for schedule(dynamic)
   for (const auto& unique_class : unique) {  // NOLINT
     try {
+      if (cached_unique_classes_.contains(unique_class.get())) {
+        continue;
+      }
       auto candidate_inst = unique_class->getFirstInst();
       // only do for core and block cells
       if (!isStdCell(candidate_inst) && !isMacroCell(candidate_inst)) {
@@ -1625,7 +1628,8 @@ void FlexPA::revertAccessPoints()
 {
   const auto& unique = unique_insts_.getUniqueClasses();
   for (const auto& unique_class : unique) {
-    if (unique_class->getInsts().empty()) {
+    if (unique_class->getInsts().empty()
+        || cached_unique_classes_.contains(unique_class.get())) {
       continue;
     }
     auto inst = unique_class->getFirstInst();
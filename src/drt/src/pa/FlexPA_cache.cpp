@@ -0,0 +1,399 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "db/obj/frAccess.h"
+#include "db/obj/frBlockage.h"
+#include "db/obj/frInst.h"
+#include "db/obj/frMPin.h"
+#include "db/obj/frMaster.h"
+#include "db/obj/frTrackPattern.h"
+#include "db/tech/frViaDef.h"
+#include "distributed/frArchive.h"
+#include "frBaseTypes.h"
+#include "frProfileTask.h"
+#include "pa/FlexPA.h"
+#include "pa/FlexPA_unique.h"
+#include "serialization.h"
+#include "utl/Logger.h"
+
+namespace drt {
+
+// Bump whenever the access point or access pattern generation changes in a
+// way that makes previously cached results invalid.
+constexpr int kCacheVersion = 1;
+
+// The cache hashes are 64-bit FNV-1a so that a cache file gives the same
+// hashes with every compiler, standard library and host byte order.
+constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001b3ULL;
+
+static void hashByte(uint64_t& seed, const uint8_t byte)
+{
+  seed ^= byte;
+  seed *= kFnvPrime;
+}
+
+template <typename T>
+  requires std::is_integral_v<T> || std::is_enum_v<T>
+static void hashCombine(uint64_t& seed, const T value)
+{
+  const uint64_t bits = static_cast<uint64_t>(value);
+  for (int i = 0; i < 8; i++) {
+    hashByte(seed, (bits >> (8 * i)) & 0xff);
+  }
+}
+
+static void hashCombine(uint64_t& seed, const std::string& value)
+{
+  hashCombine(seed, value.size());
+  for (const char c : value) {
+    hashByte(seed, static_cast<uint8_t>(c));
+  }
+}
+
+static void hashRect(uint64_t& seed, const odb::Rect& rect)
+{
+  hashCombine(seed, rect.xMin());
+  hashCombine(seed, rect.yMin());
+  hashCombine(seed, rect.xMax());
+  hashCombine(seed, rect.yMax());
+}
+
+template <typename T>
+static void hashPinFigs(uint64_t& seed, const T* pin)
+{
+  for (const auto& fig : pin->getFigs()) {
+    if (fig->typeId() == frcRect) {
+      auto rect = static_cast<frRect*>(fig.get());
+      hashCombine(seed, rect->getLayerNum());
+      hashRect(seed, rect->getBBox());
+    } else if (fig->typeId() == frcPolygon) {
+      auto polygon = static_cast<frPolygon*>(fig.get());
+      hashCombine(seed, polygon->getLayerNum());
+      for (const odb::Point& pt : polygon->getPoints()) {
+        hashCombine(seed, pt.getX());
+        hashCombine(seed, pt.getY());
+      }
+    }
+  }
+}
+
+// All pins of a master in term/pin order.  Cache entries index pins by their
+// position in this list.
+static std::vector<frMPin*> getMasterPins(frMaster* master)
+{
+  std::vector<frMPin*> pins;
+  for (auto& term : master->getTerms()) {
+    for (auto& pin : term->getPins()) {
+      pins.push_back(pin.get());
+    }
+  }
+  return pins;
+}
+
+template <class Archive>
+static void serializeCachedAPRef(Archive& ar, std::pair<int, int>& ref)
+{
+  (ar) & ref.first;
+  (ar) & ref.second;
+}
+
+void FlexPA::setCacheFile(const std::string& file_name,
+                          const std::string& tech_lef)
+{
+  cache_file_ = file_name;
+  cache_hash_ = kFnvOffsetBasis;
+  hashCombine(cache_hash_, tech_lef);
+}
+
+// Everything besides the technology and the master that the access points of
+// a unique instance depend on.
+uint64_t FlexPA::computeContextHash() const
+{
+  uint64_t seed = cache_hash_;
+  hashCombine(seed, kCacheVersion);
+  hashCombine(seed, getDesign()->getTopBlock()->getDBUPerUU());
+  for (const auto& via_def : getTech()->getVias()) {
+    hashCombine(seed, via_def->getName());
+  }
+  for (const auto* via_def : avoid_via_defs_) {
+    hashCombine(seed, via_def->getName());
+  }
+  // unique classes only capture the offset of an instance from the tracks
+  for (const auto* tp : getDesign()->getTopBlock()->getTrackPatterns()) {
+    hashCombine(seed, tp->getLayerNum());
+    hashCombine(seed, tp->isHorizontal());
+    hashCombine(seed, tp->getTrackSpacing());
+    hashCombine(seed, tp->getStartCoord() % tp->getTrackSpacing());
+  }
+  hashCombine(seed, router_cfg_->DBPROCESSNODE);
+  hashCombine(seed, router_cfg_->BOTTOM_ROUTING_LAYER);
+  hashCombine(seed, router_cfg_->TOP_ROUTING_LAYER);
+  hashCombine(seed, router_cfg_->USENONPREFTRACKS);
+  hashCombine(seed, router_cfg_->USEMINSPACING_OBS);
+  hashCombine(seed, router_cfg_->VIAINPIN_BOTTOMLAYERNUM);
+  hashCombine(seed, router_cfg_->VIAINPIN_TOPLAYERNUM);
+  hashCombine(seed, router_cfg_->VIA_ACCESS_LAYERNUM);
+  hashCombine(seed, router_cfg_->MINNUMACCESSPOINT_MACROCELLPIN);
+  hashCombine(seed, router_cfg_->MINNUMACCESSPOINT_STDCELLPIN);
+  hashCombine(seed, router_cfg_->ACCESS_PATTERN_END_ITERATION_NUM);
+  return seed;
+}
+
+uint64_t FlexPA::computeMasterHash(frMaster* master) const
+{
+  uint64_t seed = kFnvOffsetBasis;
+  hashCombine(seed, master->getName());
+  hashCombine(seed, master->getMasterType().getValue());
+  for (const auto& boundary : master->getBoundaries()) {
+    for (const odb::Point& pt : boundary.getPoints()) {
+      hashCombine(seed, pt.getX());
+      hashCombine(seed, pt.getY());
+    }
+  }
+  for (const auto& term : master->getTerms()) {
+    hashCombine(seed, term->getName());
+    hashCombine(seed, term->getType().getValue());
+    for (const auto& pin : term->getPins()) {
+      hashPinFigs(seed, pin.get());
+    }
+  }
+  for (const auto& blockage : master->getBlockages()) {
+    hashCombine(seed, blockage->getDesignRuleWidth());
+    hashPinFigs(seed, blockage->getPin());
+  }
+  return seed;
+}
+
+// Returns an empty key for unique classes that can't be cached.
+std::string FlexPA::getCacheKey(UniqueClass* unique_class) const
+{
+  if (unique_class->getInsts().empty()
+      || unique_class->key().ndr_inst != nullptr) {
+    return {};
+  }
+  frMaster* master = unique_class->getMaster();
+  auto it = master_hashes_.find(master);
+  if (it == master_hashes_.end()) {
+    return {};
+  }
+  std::string key = fmt::format(
+      "{}/{:x}/{}/",
+      master->getName(),
+      it->second,
+      unique_class->getOrient().getString());
+  for (const frCoord offset : unique_class->getOffsets()) {
+    key += fmt::format("{},", offset);
+  }
+  key += '/';
+  for (const auto& term : master->getTerms()) {
+    key += unique_class->isSkipTerm(term.get()) ? '0' : '1';
+  }
+  key += '/';
+  for (const frTerm* term : unique_class->getStubbornTerms()) {
+    key += term->getName() + ',';
+  }
+  return key;
+}
+
+void FlexPA::readCache()
+{
+  ProfileTask profile("PA:readCache");
+  cache_.clear();
+  master_hashes_.clear();
+  for (auto& master : getDesign()->getMasters()) {
+    master_hashes_[master.get()] = computeMasterHash(master.get());
+  }
+
+  std::ifstream file(cache_file_.c_str(), std::ios::binary);
+  if (!file.is_open()) {
+    return;
+  }
+  std::map<std::string, CachedUniqueClass> cache;
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    int version = 0;
+    uint64_t hash = 0;
+    ar >> version;
+    ar >> hash;
+    if (version != kCacheVersion || hash != computeContextHash()) {
+      logger_->info(DRT,
+                    355,
+                    "Pin access cache {} was written for a different "
+                    "technology or design context and is ignored.",
+                    cache_file_);
+      return;
+    }
+    int sz = 0;
+    ar >> sz;
+    while (sz--) {
+      std::string key;
+      ar >> key;
+      CachedUniqueClass& entry = cache[key];
+      ar >> entry.pin_access;
+      int num_patterns = 0;
+      ar >> num_patterns;
+      entry.patterns.resize(num_patterns);
+      for (CachedPattern& pattern : entry.patterns) {
+        int num_aps = 0;
+        ar >> num_aps;
+        pattern.aps.resize(num_aps);
+        for (CachedAPRef& ref : pattern.aps) {
+          serializeCachedAPRef(ar, ref);
+        }
+        serializeCachedAPRef(ar, pattern.left);
+        serializeCachedAPRef(ar, pattern.right);
+      }
+    }
+  } catch (const std::exception& e) {
+    logger_->warn(DRT,
+                  354,
+                  "Pin access cache {} is corrupted and is ignored: {}",
+                  cache_file_,
+                  e.what());
+    return;
+  }
+  cache_ = std::move(cache);
+}
+
+void FlexPA::writeCache()
+{
+  ProfileTask profile("PA:writeCache");
+  for (const auto& unique_class : unique_insts_.getUniqueClasses()) {
+    if (!cached_unique_classes_.contains(unique_class.get())) {
+      addToCache(unique_class.get());
+    }
+  }
+
+  std::ofstream file(cache_file_.c_str(), std::ios::binary);
+  if (!file.is_open()) {
+    logger_->warn(DRT, 356, "Unable to write pin access cache {}.", cache_file_);
+    return;
+  }
+  frOArchive ar(file);
+  registerTypes(ar);
+  const uint64_t hash = computeContextHash();
+  ar << kCacheVersion;
+  ar << hash;
+  const int sz = cache_.size();
+  ar << sz;
+  for (auto& [key, entry] : cache_) {
+    ar << key;
+    ar << entry.pin_access;
+    const int num_patterns = entry.patterns.size();
+    ar << num_patterns;
+    for (CachedPattern& pattern : entry.patterns) {
+      const int num_aps = pattern.aps.size();
+      ar << num_aps;
+      for (CachedAPRef& ref : pattern.aps) {
+        serializeCachedAPRef(ar, ref);
+      }
+      serializeCachedAPRef(ar, pattern.left);
+      serializeCachedAPRef(ar, pattern.right);
+    }
+  }
+  file.close();
+}
+
+bool FlexPA::applyCache(UniqueClass* unique_class)
+{
+  const std::string key = getCacheKey(unique_class);
+  if (key.empty()) {
+    return false;
+  }
+  auto it = cache_.find(key);
+  if (it == cache_.end()) {
+    return false;
+  }
+  const CachedUniqueClass& entry = it->second;
+  const std::vector<frMPin*> pins = getMasterPins(unique_class->getMaster());
+  if (pins.size() != entry.pin_access.size()) {
+    return false;
+  }
+  const int pin_access_idx = unique_class->getPinAccessIdx();
+  for (int i = 0; i < (int) pins.size(); i++) {
+    pins[i]->setPinAccess(
+        pin_access_idx, std::make_unique<frPinAccess>(*entry.pin_access[i]));
+  }
+  return true;
+}
+
+void FlexPA::applyCachedPatterns(UniqueClass* unique_class)
+{
+  const CachedUniqueClass& entry = cache_.at(getCacheKey(unique_class));
+  const std::vector<frMPin*> pins = getMasterPins(unique_class->getMaster());
+  const int pin_access_idx = unique_class->getPinAccessIdx();
+  auto get_ap = [&](const CachedAPRef& ref) -> frAccessPoint* {
+    if (ref.first < 0) {
+      return nullptr;
+    }
+    return pins[ref.first]->getPinAccess(pin_access_idx)->getAccessPoint(
+        ref.second);
+  };
+  auto& patterns = unique_inst_patterns_.at(unique_class);
+  patterns.clear();
+  for (const CachedPattern& cached_pattern : entry.patterns) {
+    auto pattern = std::make_unique<FlexPinAccessPattern>();
+    for (const CachedAPRef& ref : cached_pattern.aps) {
+      pattern->addAccessPoint(get_ap(ref));
+    }
+    pattern->setBoundaryAP(true, get_ap(cached_pattern.left));
+    pattern->setBoundaryAP(false, get_ap(cached_pattern.right));
+    pattern->updateCost();
+    patterns.push_back(std::move(pattern));
+  }
+}
+
+void FlexPA::addToCache(UniqueClass* unique_class)
+{
+  const std::string key = getCacheKey(unique_class);
+  if (key.empty()) {
+    return;
+  }
+  frInst* unique_inst = unique_class->getFirstInst();
+  if (!isStdCell(unique_inst) && !isMacroCell(unique_inst)) {
+    return;
+  }
+  const std::vector<frMPin*> pins = getMasterPins(unique_class->getMaster());
+  const int pin_access_idx = unique_class->getPinAccessIdx();
+  CachedUniqueClass entry;
+  std::map<frPin*, int> pin_to_idx;
+  for (int i = 0; i < (int) pins.size(); i++) {
+    entry.pin_access.push_back(
+        std::make_unique<frPinAccess>(*pins[i]->getPinAccess(pin_access_idx)));
+    pin_to_idx[pins[i]] = i;
+  }
+  auto get_ref = [&](frAccessPoint* ap) -> CachedAPRef {
+    if (ap == nullptr) {
+      return {-1, -1};
+    }
+    return {pin_to_idx.at(ap->getPinAccess()->getPin()), ap->getId()};
+  };
+  auto it = unique_inst_patterns_.find(unique_class);
+  if (it != unique_inst_patterns_.end()) {
+    for (const auto& pattern : it->second) {
+      CachedPattern cached_pattern;
+      for (frAccessPoint* ap : pattern->getPattern()) {
+        cached_pattern.aps.push_back(get_ref(ap));
+      }
+      cached_pattern.left = get_ref(pattern->getBoundaryAP(true));
+      cached_pattern.right = get_ref(pattern->getBoundaryAP(false));
+      entry.patterns.push_back(std::move(cached_pattern));
+    }
+  }
+  cache_[key] = std::move(entry);
+}
+
+}  // namespace drt
@@ -781,6 +781,9 @@ void RouterConfiguration::serialize(Archive& ar, const unsigned int /*version*/)
   (ar) & DO_PA;
   (ar) & SINGLE_STEP_DR;
   (ar) & SAVE_GUIDE_UPDATES;
+  (ar) & PA_CACHE_FILE;
+  (ar) & MAZE_LANDMARKS;
+  (ar) & NUM_WORKER_PROCS;
 
   (ar) & VIAINPIN_BOTTOMLAYER_NAME;
   (ar) & VIAINPIN_TOPLAYER_NAME;
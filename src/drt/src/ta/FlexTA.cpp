@@ -4,9 +4,14 @@
 #include "ta/FlexTA.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <latch>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -18,9 +23,9 @@
 #include "frDesign.h"
 #include "frProfileTask.h"
 #include "odb/dbTypes.h"
-#include "omp.h"
 #include "ta/AbstractTAGraphics.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 #include "utl/exception.h"
 
 using odb::dbTechLayerDir;
@@ -97,6 +102,11 @@ FlexTA::FlexTA(frDesign* in,
 
 FlexTA::~FlexTA() = default;
 
+// Panels are grouped in batches of BATCHSIZETA in panel order.  A panel sees
+// the assignments of the earlier batches but not those of its own batch, as
+// if every batch ran and then ended together.  processWorkers keeps that
+// result while letting panels run ahead of their batch where no neighbor
+// holds them back.
 int FlexTA::initTA_helper(int iter,
                           int size,
                           int offset,
@@ -106,9 +116,7 @@ int FlexTA::initTA_helper(int iter,
   auto gCellPatterns = getDesign()->getTopBlock()->getGCellPatterns();
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
-  int sol = 0;
-  numPanels = 0;
-  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
+  std::vector<std::unique_ptr<FlexTAWorker>> panels;
   if (isH) {
     for (int i = offset; i < (int) ygp.getCount(); i += size) {
       auto uworker = std::make_unique<FlexTAWorker>(
@@ -127,11 +135,7 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::HORIZONTAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().emplace_back(std::move(uworker));
+      panels.push_back(std::move(uworker));
     }
   } else {
     for (int i = offset; i < (int) xgp.getCount(); i += size) {
@@ -151,39 +155,130 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::VERTICAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
+      panels.push_back(std::move(uworker));
+    }
+  }
+
+  return processWorkers(panels, iter, isH, numPanels);
+}
+
+int FlexTA::processWorkers(std::vector<std::unique_ptr<FlexTAWorker>>& workers,
+                           int iter,
+                           bool isH,
+                           int& numPanels)
+{
+  ProfileTask profile("TA:workers");
+  using std::chrono::duration;
+  using std::chrono::high_resolution_clock;
+  const auto start = high_resolution_clock::now();
+
+  // Each panel has a main step (main_mt) and an end step, numbered 2 * i
+  // and 2 * i + 1.  Only panels whose ext boxes intersect can see each
+  // other's assignments, so only they are ordered:
+  // - a panel's main step waits for the end of overlapping panels in
+  //   earlier batches;
+  // - a panel's end waits for the main step of overlapping panels in its
+  //   own batch, which must not see it, and for the end of every earlier
+  //   overlapping panel, so ends apply in panel order.
+  // Panels span the whole die in one direction, so only a few of them
+  // overlap and a pairwise check is cheap.
+  const int num_steps = 2 * workers.size();
+  std::vector<std::vector<int>> dependents(num_steps);
+  std::vector<std::atomic<int>> num_pending(num_steps);
+  auto add_dependency = [&](const int step, const int dependent) {
+    dependents[step].push_back(dependent);
+    num_pending[dependent]++;
+  };
+  for (int i = 0; i < (int) workers.size(); i++) {
+    add_dependency(2 * i, 2 * i + 1);
+    const int batch = i / router_cfg_->BATCHSIZETA;
+    for (int j = 0; j < i; j++) {
+      if (!workers[j]->getExtBox().intersects(workers[i]->getExtBox())) {
+        continue;
+      }
+      if (j / router_cfg_->BATCHSIZETA == batch) {
+        add_dependency(2 * j, 2 * i + 1);
+        add_dependency(2 * i, 2 * j + 1);
+      } else {
+        add_dependency(2 * j + 1, 2 * i);
       }
-      workers.back().push_back(std::move(uworker));
+      add_dependency(2 * j + 1, 2 * i + 1);
     }
   }
 
-  omp_set_num_threads(std::min(8, router_cfg_->MAX_THREADS));
-  // parallel execution
-  // multi thread
-  for (auto& workerBatch : workers) {
-    ProfileTask profile("TA:batch");
-    utl::ThreadException exception;
-#pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
+  std::atomic<int> sol = 0;
+  std::atomic<int> num_ended = 0;
+  std::atomic<int64_t> busy_us = 0;
+  // end() only touches the guides of its own panel, but the drUpdates it
+  // records go to a shared list in the design.
+  std::mutex updates_mutex;
+  utl::ThreadException exception;
+  std::latch done(num_steps);
+  utl::ThreadPool pool(router_cfg_->MAX_THREADS);
+  std::function<void(int)> run_step = [&](const int step) {
+    auto& worker = workers[step / 2];
+    const bool is_end = step % 2 == 1;
+    // After a failure the remaining steps are drained without running.
+    if (!exception.hasException()) {
       try {
-        workerBatch[i]->main_mt();
-#pragma omp critical
-        {
-          sol += workerBatch[i]->getNumAssigned();
-          numPanels++;
+        const auto step_start = high_resolution_clock::now();
+        if (!is_end) {
+          worker->main_mt();
+          sol += worker->getNumAssigned();
+        } else {
+          ProfileTask profile("TA:end");
+          std::unique_lock<std::mutex> lock(updates_mutex, std::defer_lock);
+          if (save_updates_) {
+            lock.lock();
+          }
+          worker->end();
+          num_ended++;
         }
+        busy_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                       high_resolution_clock::now() - step_start)
+                       .count();
       } catch (...) {
         exception.capture();
       }
     }
-    exception.rethrow();
-    for (auto& worker : workerBatch) {
-      worker->end();
+    if (is_end) {
+      worker.reset();
+    }
+    for (const int dependent : dependents[step]) {
+      if (--num_pending[dependent] == 0) {
+        pool.submit([&run_step, dependent]() { run_step(dependent); });
+      }
+    }
+    done.count_down();
+  };
+  for (int step = 0; step < num_steps; step++) {
+    if (num_pending[step] == 0) {
+      pool.submit([&run_step, step]() { run_step(step); });
     }
-    workerBatch.clear();
   }
+  ProfileTask wait_profile("TA:wait_workers");
+  done.wait();
+  wait_profile.done();
+  exception.rethrow();
+  workers.clear();
+
+  const double wall = duration<double>(high_resolution_clock::now() - start)
+                          .count();
+  const double busy = busy_us / 1e6;
+  debugPrint(logger_,
+             DRT,
+             "track_assignment",
+             1,
+             "Iter {} {}: {} panels on {} threads in {:.2f}s, busy {:.2f}s, "
+             "speedup {:.2f}.",
+             iter,
+             isH ? "horizontal" : "vertical",
+             num_ended.load(),
+             router_cfg_->MAX_THREADS,
+             wall,
+             busy,
+             wall > 0 ? busy / wall : 0.0);
+  numPanels = num_ended;
   return sol;
 }
 
@@ -25,6 +25,7 @@
 namespace drt {
 class FlexTAGraphics;
 class AbstractTAGraphics;
+class FlexTAWorker;
 
 class FlexTA
 {
@@ -54,6 +55,10 @@ class FlexTA
   void initTA(int size);
   void searchRepair(int iter, int size, int offset);
   int initTA_helper(int iter, int size, int offset, bool isH, int& numPanels);
+  int processWorkers(std::vector<std::unique_ptr<FlexTAWorker>>& workers,
+                     int iter,
+                     bool isH,
+                     int& numPanels);
 };
 
 class FlexTAWorker;
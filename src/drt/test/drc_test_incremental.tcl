@@ -0,0 +1,37 @@
+# check_drc -incremental after a routing edit matches a full check_drc.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+
+set base_file [make_result_file drc_test_incremental_base.drc]
+set incr_file [make_result_file drc_test_incremental_incr.drc]
+set full_file [make_result_file drc_test_incremental_full.drc]
+
+drt::check_drc -output_file $base_file
+
+# Append the routing of one net to another so that the two nets short
+# wherever the first one is routed.
+set routed_nets {}
+foreach net [[ord::get_db_block] getNets] {
+  if { ![$net isSpecial] && [$net getWire] != "NULL" } {
+    lappend routed_nets $net
+    if { [llength $routed_nets] == 2 } {
+      break
+    }
+  }
+}
+lassign $routed_nets src_net dst_net
+[$dst_net getWire] append [$src_net getWire]
+
+tee -quiet -variable report \
+  [list drt::check_drc -incremental -output_file $incr_file]
+drt::check_drc -output_file $full_file
+
+check "incremental check ran" { string match "*DRT-0359*" $report } 1
+check "the edit adds markers" { diff_files $base_file $full_file } 1
+check "incremental matches full check" {
+  diff_files $full_file $incr_file
+} 0
+
+exit_summary
@@ -0,0 +1,53 @@
+# detailed_route with the landmark maze heuristic routes ispd18_sample like
+# the default search. Ties between equal cost paths may be broken
+# differently, so the routing is compared by wire length, not line by line.
+source "helpers.tcl"
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set def_file [make_result_file ispd18_sample_maze_landmarks.def]
+
+set_routing_layers -signal Metal1-Metal9
+detailed_route -verbose 0 -maze_landmarks 4
+
+write_def $def_file
+
+# The default search result in a separate database
+set ref_db [odb::dbDatabase_create]
+odb::read_lef $ref_db testcase/ispd18_sample/ispd18_sample.input.lef
+set ref_block [[odb::read_def [$ref_db getTech] ispd18_sample.defok] getBlock]
+
+# Returns a dict of net name to routed wire length
+proc wire_lengths { block } {
+  set lengths [dict create]
+  foreach net [$block getNets] {
+    set wire [$net getWire]
+    if { $wire != "NULL" } {
+      dict set lengths [$net getName] [$wire getLength]
+    }
+  }
+  return $lengths
+}
+
+proc total_length { lengths } {
+  set total 0
+  dict for { net length } $lengths {
+    incr total $length
+  }
+  return $total
+}
+
+set lengths [wire_lengths [ord::get_db_block]]
+set ref_lengths [wire_lengths $ref_block]
+
+check "same nets are routed" {
+  expr { [lsort [dict keys $lengths]] == [lsort [dict keys $ref_lengths]] }
+} 1
+check "wire length within 1% of the default search" {
+  set total [total_length $lengths]
+  set ref_total [total_length $ref_lengths]
+  expr { abs($total - $ref_total) <= 0.01 * $ref_total }
+} 1
+
+exit_summary
@@ -0,0 +1,18 @@
+# detailed_route with several threads matches the single threaded result.
+source "helpers.tcl"
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set def_file [make_result_file ispd18_sample_threads.def]
+
+set_thread_count 4
+set_routing_layers -signal Metal1-Metal9
+detailed_route -verbose 0
+
+write_def $def_file
+check "threaded routing matches single threaded routing" {
+  diff_files ispd18_sample.defok $def_file
+} 0
+
+exit_summary
@@ -0,0 +1,19 @@
+# detailed_route in forked worker processes, with the commits of each batch
+# prepared on several threads, matches the serial result.
+source "helpers.tcl"
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set def_file [make_result_file ispd18_sample_worker_processes.def]
+
+set_thread_count 2
+set_routing_layers -signal Metal1-Metal9
+detailed_route -verbose 0 -worker_processes 2
+
+write_def $def_file
+check "batch commits match serial routing" {
+  diff_files ispd18_sample.defok $def_file
+} 0
+
+exit_summary
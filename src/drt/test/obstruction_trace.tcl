@@ -0,0 +1,55 @@
+# detailed_route_trace writes a Chrome trace of the routing tasks.
+source "helpers.tcl"
+read_lef "sky130hs/sky130hs.tlef"
+read_lef "sky130hs/sky130hs_std_cell.lef"
+read_def "obstruction.def"
+read_guides "obstruction.guide"
+
+set trace_file [make_result_file obstruction_trace.json]
+
+set_routing_layers -signal met1-met5
+detailed_route_trace -start
+detailed_route -verbose 0
+tee -quiet -variable report \
+  [list detailed_route_trace -stop -output_file $trace_file]
+
+# The trace is one JSON object with one event per line.
+set stream [open $trace_file r]
+set lines [split [string trim [read $stream]] "\n"]
+close $stream
+
+set string_re {"(?:[^"\\]|\\.)*"}
+set complete_re "^\\{\"name\":$string_re,\"ph\":\"X\",\"ts\":\\d+,\"dur\":\\d+,\"pid\":0,\"tid\":\\d+\\},?\$"
+set metadata_re "^\\{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":\\d+,\"args\":\\{\"name\":$string_re\\}\\},?\$"
+set num_events 0
+set num_bad_lines 0
+set has_dr_task 0
+foreach line [lrange $lines 1 end-1] {
+  if { [regexp $complete_re $line] } {
+    incr num_events
+    if { [string match "*\"name\":\"DR:*" $line] } {
+      set has_dr_task 1
+    }
+  } elseif { ![regexp $metadata_re $line] } {
+    incr num_bad_lines
+  }
+}
+
+check "trace header" {
+  lindex $lines 0
+} "{\"displayTimeUnit\":\"ms\",\"traceEvents\":\["
+check "trace footer" { lindex $lines end } "\]\}"
+check "every line is a trace event" { set num_bad_lines } 0
+check "events are written" { expr { $num_events > 0 } } 1
+check "detailed routing tasks are traced" { set has_dr_task } 1
+check "reported event count" {
+  regexp "Wrote $num_events trace events" $report
+} 1
+
+set def_file [make_result_file obstruction_trace.def]
+write_def $def_file
+check "tracing does not change routing" {
+  diff_files obstruction.defok $def_file
+} 0
+
+exit_summary
@@ -0,0 +1,19 @@
+# detailed_route in forked worker processes matches the threaded obstruction
+# result.
+source "helpers.tcl"
+read_lef "sky130hs/sky130hs.tlef"
+read_lef "sky130hs/sky130hs_std_cell.lef"
+read_def "obstruction.def"
+read_guides "obstruction.guide"
+
+set def_file [make_result_file obstruction_worker_processes.def]
+
+set_routing_layers -signal met1-met5
+detailed_route -verbose 0 -worker_processes 2
+
+write_def $def_file
+check "forked routing matches threaded routing" {
+  diff_files obstruction.defok $def_file
+} 0
+
+exit_summary
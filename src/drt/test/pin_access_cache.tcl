@@ -0,0 +1,58 @@
+# pin access cache round trip and invalidation. def file from the openroad-flow (modified gcd_sky130hs)
+source "helpers.tcl"
+read_lef "sky130hs/sky130hs.tlef"
+read_lef "sky130hs/sky130hs_std_cell.lef"
+read_def "obstruction.def"
+
+set_routing_layers -signal met1-met5
+
+set cache_file [make_result_file pin_access_cache.pa]
+file delete -force $cache_file
+
+proc access_points { } {
+  set aps {}
+  foreach inst [[ord::get_db_block] getInsts] {
+    foreach iterm [$inst getITerms] {
+      foreach ap [$iterm getPrefAccessPoints] {
+        lappend aps [list [$iterm getName] [$ap getPoint] \
+          [[$ap getLayer] getName]]
+      }
+    }
+  }
+  return $aps
+}
+
+# Returns the number of unique instances reused from the cache
+proc run_pin_access { args } {
+  global cache_file report
+  tee -quiet -variable report \
+    [list pin_access -verbose 1 -pin_access_cache $cache_file {*}$args]
+  if { ![regexp {Reused pin access of (\d+) of} $report -> reused] } {
+    return -1
+  }
+  return $reused
+}
+
+check "no cache file" { run_pin_access } 0
+check "cache file written" { file exists $cache_file } 1
+set aps [access_points]
+check "access points generated" { expr { [llength $aps] > 0 } } 1
+
+check "cache reused" { expr { [run_pin_access] > 0 } } 1
+check "cached access points match" { expr { [access_points] == $aps } } 1
+
+# A corrupted cache is ignored and rewritten
+set stream [open $cache_file w]
+puts $stream "not a pin access cache"
+close $stream
+check "corrupted cache" { run_pin_access } 0
+check "corrupted cache is reported" { string match "*DRT-0354*" $report } 1
+check "access points after corrupted cache" \
+  { expr { [access_points] == $aps } } 1
+check "rewritten cache reused" { expr { [run_pin_access] > 0 } } 1
+
+# Different pin access settings invalidate the whole cache
+check "settings changed" { run_pin_access -min_access_points 5 } 0
+check "invalidation is reported" { string match "*DRT-0355*" $report } 1
+
+exit_summary
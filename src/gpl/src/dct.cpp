@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "dct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "fft.h"
+
+namespace gpl {
+
+namespace {
+
+// Columns gathered together in the column pass of the Ooura path.
+constexpr int kColumnBlock = 8;
+
+bool useOoura(int n)
+{
+  return n >= 4 && (n & (n - 1)) == 0;
+}
+
+// y[0, n) += alpha * x[0, n)
+void axpy(float alpha, const float* x, float* y, int n)
+{
+  int i = 0;
+#ifdef __AVX2__
+  const __m256 va = _mm256_set1_ps(alpha);
+  for (; i + 8 <= n; i += 8) {
+    const __m256 vx = _mm256_loadu_ps(x + i);
+    const __m256 vy = _mm256_loadu_ps(y + i);
+    _mm256_storeu_ps(y + i, _mm256_add_ps(vy, _mm256_mul_ps(va, vx)));
+  }
+#endif
+  for (; i < n; i++) {
+    y[i] += alpha * x[i];
+  }
+}
+
+void ooura1d(int n, int isgn, DCT::Kind kind, float* a, int* ip, float* w)
+{
+  if (kind == DCT::Kind::kCos) {
+    ddct(n, isgn, a, ip, w);
+  } else {
+    ddst(n, isgn, a, ip, w);
+  }
+}
+
+}  // namespace
+
+DCT::DCT(int n1, int n2, int num_threads)
+    : n1_(n1), n2_(n2), num_threads_(num_threads)
+{
+  scratch_.resize(static_cast<size_t>(n1_) * n2_);
+
+  int n = 0;
+  if (useOoura(n1_)) {
+    n = n1_;
+  }
+  if (useOoura(n2_)) {
+    n = std::max(n, n2_);
+  }
+  if (n == 0) {
+    return;
+  }
+
+  // Same initialization as ddct2d so the tables are never rewritten by the
+  // 1D routines, which makes them safe to share between threads.
+  ip_.resize(std::lround(std::sqrt(n)) + 2, 0);
+  w_.resize(n * 3 / 2, 0);
+  const int nw = n >> 2;
+  makewt(nw, ip_.data(), w_.data());
+  makect(n, ip_.data(), w_.data() + nw);
+}
+
+void DCT::transform(float** a, int isgn, Kind kind1, Kind kind2)
+{
+  // Same order as the Ooura 2D routines: rows first, then columns.
+  transformRows(a, isgn, kind2);
+  transformColumns(a, isgn, kind1);
+}
+
+void DCT::transformRows(float** a, int isgn, Kind kind)
+{
+  if (useOoura(n2_)) {
+#pragma omp parallel for num_threads(num_threads_)
+    for (int i = 0; i < n1_; i++) {
+      ooura1d(n2_, isgn, kind, a[i], ip_.data(), w_.data());
+    }
+    return;
+  }
+
+  const std::vector<float>& basis = getBasis(1, isgn, kind);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < n1_; i++) {
+    float* out = scratch_.data() + static_cast<size_t>(i) * n2_;
+    std::fill(out, out + n2_, 0.0f);
+    for (int j = 0; j < n2_; j++) {
+      axpy(a[i][j], basis.data() + static_cast<size_t>(j) * n2_, out, n2_);
+    }
+    std::copy(out, out + n2_, a[i]);
+  }
+}
+
+void DCT::transformColumns(float** a, int isgn, Kind kind)
+{
+  if (useOoura(n1_)) {
+    // Each block of columns is gathered into its own slice of scratch_.
+#pragma omp parallel for num_threads(num_threads_)
+    for (int j0 = 0; j0 < n2_; j0 += kColumnBlock) {
+      const int width = std::min(kColumnBlock, n2_ - j0);
+      float* t = scratch_.data() + static_cast<size_t>(j0) * n1_;
+      for (int i = 0; i < n1_; i++) {
+        for (int c = 0; c < width; c++) {
+          t[c * n1_ + i] = a[i][j0 + c];
+        }
+      }
+      for (int c = 0; c < width; c++) {
+        ooura1d(n1_, isgn, kind, t + c * n1_, ip_.data(), w_.data());
+      }
+      for (int i = 0; i < n1_; i++) {
+        for (int c = 0; c < width; c++) {
+          a[i][j0 + c] = t[c * n1_ + i];
+        }
+      }
+    }
+    return;
+  }
+
+  const std::vector<float>& basis = getBasis(0, isgn, kind);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int k = 0; k < n1_; k++) {
+    float* out = scratch_.data() + static_cast<size_t>(k) * n2_;
+    std::fill(out, out + n2_, 0.0f);
+    for (int j = 0; j < n1_; j++) {
+      axpy(basis[static_cast<size_t>(j) * n1_ + k], a[j], out, n2_);
+    }
+  }
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < n1_; i++) {
+    const float* out = scratch_.data() + static_cast<size_t>(i) * n2_;
+    std::copy(out, out + n2_, a[i]);
+  }
+}
+
+const std::vector<float>& DCT::getBasis(int dim, int isgn, Kind kind)
+{
+  std::vector<float>& basis
+      = basis_[dim][isgn >= 0 ? 1 : 0][kind == Kind::kCos ? 0 : 1];
+  if (!basis.empty()) {
+    return basis;
+  }
+
+  const int n = (dim == 0) ? n1_ : n2_;
+  basis.resize(static_cast<size_t>(n) * n);
+  constexpr double kPi = std::numbers::pi;
+  for (int j = 0; j < n; j++) {
+    for (int k = 0; k < n; k++) {
+      double value;
+      if (kind == Kind::kCos) {
+        // ddct: C[k] = sum_j a[j] * cos(pi * (j + 1/2) * k / n) forward and
+        // sum_j a[j] * cos(pi * j * (k + 1/2) / n) inverse.
+        value = (isgn < 0) ? std::cos(kPi * (j + 0.5) * k / n)
+                           : std::cos(kPi * j * (k + 0.5) / n);
+      } else if (isgn < 0) {
+        // ddst forward: S[k] for 0 < k <= n with S[n] stored in a[0].
+        const int freq = (k == 0) ? n : k;
+        value = std::sin(kPi * (j + 0.5) * freq / n);
+      } else {
+        // ddst inverse: A[j] for 0 < j <= n with A[n] read from a[0].
+        const int freq = (j == 0) ? n : j;
+        value = std::sin(kPi * freq * (k + 0.5) / n);
+      }
+      basis[static_cast<size_t>(j) * n + k] = value;
+    }
+  }
+  return basis;
+}
+
+}  // namespace gpl
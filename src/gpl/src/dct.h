@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <vector>
+
+namespace gpl {
+
+// 2D cosine/sine transforms of an n1 x n2 array a[i][j] (i < n1, j < n2)
+// following the conventions of Ooura's ddct2d/ddsct2d/ddcst2d.
+//
+// Each dimension is transformed with Ooura's 1D ddct/ddst when its length is
+// a power of two (>= 4), so results are bitwise identical to the 2D Ooura
+// routines, and with a precomputed basis matrix otherwise.  Rows and columns
+// are split across the OpenMP threads; the matrix products use AVX2 when the
+// compiler targets it.
+class DCT
+{
+ public:
+  enum class Kind
+  {
+    kCos,
+    kSin
+  };
+
+  DCT(int n1, int n2, int num_threads);
+
+  // isgn < 0 is the forward transform and isgn >= 0 the inverse (excluding
+  // scale) as in ddct/ddst.  kind1 applies along the first index and kind2
+  // along the second: (kCos, kCos) is ddct2d, (kSin, kCos) is ddsct2d and
+  // (kCos, kSin) is ddcst2d.
+  void transform(float** a, int isgn, Kind kind1, Kind kind2);
+
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
+ private:
+  // Transform along the second index (contiguous rows).
+  void transformRows(float** a, int isgn, Kind kind);
+  // Transform along the first index.
+  void transformColumns(float** a, int isgn, Kind kind);
+
+  // out[k] = sum_j in[j] * basis[j * n + k] for the dimension of length n.
+  const std::vector<float>& getBasis(int dim, int isgn, Kind kind);
+
+  int n1_ = 0;
+  int n2_ = 0;
+  int num_threads_ = 1;
+
+  // Ooura tables, shared by both dimensions when they use the 1D routines.
+  std::vector<int> ip_;
+  std::vector<float> w_;
+
+  // Lazily built basis matrices indexed by [dim][isgn >= 0][kind].
+  std::vector<float> basis_[2][2][2];
+
+  // n1 * n2 work area for the column pass and the matrix products.
+  std::vector<float> scratch_;
+};
+
+}  // namespace gpl
@@ -3,47 +3,50 @@
 
 #include "fft.h"
 
-#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <numbers>
 #include <utility>
 
 namespace gpl {
 
-FFT::FFT(int bin_cnt_x, int bin_cnt_y, float bin_size_x, float bin_size_y)
+FFT::FFT(int bin_cnt_x,
+         int bin_cnt_y,
+         float bin_size_x,
+         float bin_size_y,
+         int num_threads)
     : bin_cnt_X_(bin_cnt_x),
       bin_cnt_y_(bin_cnt_y),
       bin_size_x_(bin_size_x),
-      bin_size_y_(bin_size_y)
+      bin_size_y_(bin_size_y),
+      num_threads_(num_threads),
+      dct_(bin_cnt_x, bin_cnt_y, num_threads)
 {
   bin_density_ = new float*[bin_cnt_X_];
   electro_phi_ = new float*[bin_cnt_X_];
   electro_field_x_ = new float*[bin_cnt_X_];
   electro_field_y_ = new float*[bin_cnt_X_];
 
-  for (int i = 0; i < bin_cnt_X_; i++) {
-    bin_density_[i] = new float[bin_cnt_y_];
-    electro_phi_[i] = new float[bin_cnt_y_];
-    electro_field_x_[i] = new float[bin_cnt_y_];
-    electro_field_y_[i] = new float[bin_cnt_y_];
+  const size_t size = static_cast<size_t>(bin_cnt_X_) * bin_cnt_y_;
+  bin_density_[0] = new float[size]();
+  electro_phi_[0] = new float[size]();
+  electro_field_x_[0] = new float[size]();
+  electro_field_y_[0] = new float[size]();
 
-    for (int j = 0; j < bin_cnt_y_; j++) {
-      bin_density_[i][j] = electro_phi_[i][j] = electro_field_x_[i][j]
-          = electro_field_y_[i][j] = 0.0f;
-    }
+  for (int i = 1; i < bin_cnt_X_; i++) {
+    bin_density_[i] = bin_density_[i - 1] + bin_cnt_y_;
+    electro_phi_[i] = electro_phi_[i - 1] + bin_cnt_y_;
+    electro_field_x_[i] = electro_field_x_[i - 1] + bin_cnt_y_;
+    electro_field_y_[i] = electro_field_y_[i - 1] + bin_cnt_y_;
   }
 
-  cs_table_.resize(std::max(bin_cnt_X_, bin_cnt_y_) * 3 / 2, 0);
-
   wx_.resize(bin_cnt_X_, 0);
   wx_square_.resize(bin_cnt_X_, 0);
   wy_.resize(bin_cnt_y_, 0);
   wy_square_.resize(bin_cnt_y_, 0);
 
-  work_area_.resize(round(sqrt(std::max(bin_cnt_X_, bin_cnt_y_))) + 2, 0);
-
   constexpr auto kPi = std::numbers::pi_v<long double>;
 
   for (int i = 0; i < bin_cnt_X_; i++) {
@@ -60,25 +63,14 @@ FFT::FFT(int bin_cnt_x, int bin_cnt_y, float bin_size_x, float bin_size_y)
 
 FFT::~FFT()
 {
-  using std::vector;
-  for (int i = 0; i < bin_cnt_X_; i++) {
-    delete[] bin_density_[i];
-    delete[] electro_phi_[i];
-    delete[] electro_field_x_[i];
-    delete[] electro_field_y_[i];
-  }
+  delete[] bin_density_[0];
+  delete[] electro_phi_[0];
+  delete[] electro_field_x_[0];
+  delete[] electro_field_y_[0];
   delete[] bin_density_;
   delete[] electro_phi_;
   delete[] electro_field_x_;
   delete[] electro_field_y_;
-
-  cs_table_.clear();
-  wx_.clear();
-  wx_square_.clear();
-  wy_.clear();
-  wy_square_.clear();
-
-  work_area_.clear();
 }
 
 void FFT::updateDensity(int x, int y, float density)
@@ -98,88 +90,48 @@ float FFT::getElectroPhi(int x, int y) const
 
 void FFT::doFFT()
 {
-  ddct2d(bin_cnt_X_,
-         bin_cnt_y_,
-         -1,
-         bin_density_,
-         nullptr,
-         work_area_.data(),
-         cs_table_.data());
-
-  // Normalizations required to perform the inverse operation
-  for (int i = 1; i < bin_cnt_X_; i++) {
-    bin_density_[i][0] *= 0.5;
-  }
-  for (int i = 1; i < bin_cnt_y_; i++) {
-    bin_density_[0][i] *= 0.5;
-  }
+  dct_.transform(bin_density_, -1, DCT::Kind::kCos, DCT::Kind::kCos);
+
+  const double scale = 4.0 / bin_cnt_X_ / bin_cnt_y_;
+
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < bin_cnt_X_; i++) {
+    float* density = bin_density_[i];
+    float* phi = electro_phi_[i];
+    float* electro_x = electro_field_x_[i];
+    float* electro_y = electro_field_y_[i];
+    const float wx = wx_[i];
+    const float wx2 = wx_square_[i];
+
+    // Normalizations required to perform the inverse operation
+    if (i == 0) {
+      for (int j = 1; j < bin_cnt_y_; j++) {
+        density[j] *= 0.5;
+      }
+    } else {
+      density[0] *= 0.5;
+    }
     for (int j = 0; j < bin_cnt_y_; j++) {
-      bin_density_[i][j] *= 4.0 / bin_cnt_X_ / bin_cnt_y_;
+      density[j] *= scale;
     }
-  }
 
-  // Solve the PDE in the new basis
-  for (int i = 0; i < bin_cnt_X_; i++) {
-    float wx = wx_[i];
-    float wx2 = wx_square_[i];
-
-    for (int j = 0; j < bin_cnt_y_; j++) {
-      float wy = wy_[j];
-      float wy2 = wy_square_[j];
-
-      float density = bin_density_[i][j];
-      float phi = 0;
-      float electro_x = 0, electro_y = 0;
-
-      if (i == 0 && j == 0) {
-        // Removes the DC component
-        phi = electro_x = electro_y = 0.0f;
-      } else {
-        //////////// lutong
-        //  denom =
-        //  wx2 / 4.0 +
-        //  wy2 / 4.0 ;
-        // a_phi = a_den / denom ;
-        ////b_phi = 0 ; // -1.0 * b / denom ;
-        ////a_ex = 0 ; // b_phi * wx ;
-        // a_ex = a_phi * wx / 2.0 ;
-        ////a_ey = 0 ; // b_phi * wy ;
-        // a_ey = a_phi * wy / 2.0 ;
-        ///////////
-        phi = density / (wx2 + wy2);
-        electro_x = phi * wx;
-        electro_y = phi * wy;
-      }
+    // Solve the PDE in the new basis
+    for (int j = (i == 0) ? 1 : 0; j < bin_cnt_y_; j++) {
+      phi[j] = density[j] / (wx2 + wy_square_[j]);
+      electro_x[j] = phi[j] * wx;
+      electro_y[j] = phi[j] * wy_[j];
+    }
 
-      electro_phi_[i][j] = phi;
-      electro_field_x_[i][j] = electro_x;
-      electro_field_y_[i][j] = electro_y;
+    if (i == 0) {
+      // Removes the DC component
+      phi[0] = electro_x[0] = electro_y[0] = 0.0f;
     }
   }
 
   // Inverse DCT
-  ddct2d(bin_cnt_X_,
-         bin_cnt_y_,
-         1,
-         electro_phi_,
-         nullptr,
-         work_area_.data(),
-         cs_table_.data());
-  ddsct2d(bin_cnt_X_,
-          bin_cnt_y_,
-          1,
-          electro_field_x_,
-          nullptr,
-          work_area_.data(),
-          cs_table_.data());
-  ddcst2d(bin_cnt_X_,
-          bin_cnt_y_,
-          1,
-          electro_field_y_,
-          nullptr,
-          work_area_.data(),
-          cs_table_.data());
+  dct_.transform(electro_phi_, 1, DCT::Kind::kCos, DCT::Kind::kCos);
+  dct_.transform(electro_field_x_, 1, DCT::Kind::kSin, DCT::Kind::kCos);
+  dct_.transform(electro_field_y_, 1, DCT::Kind::kCos, DCT::Kind::kSin);
 }
 
 }  // namespace gpl
@@ -6,12 +6,18 @@
 #include <utility>
 #include <vector>
 
+#include "dct.h"
+
 namespace gpl {
 
 class FFT
 {
  public:
-  FFT(int bin_cnt_x, int bin_cnt_y, float bin_size_x, float bin_size_y);
+  FFT(int bin_cnt_x,
+      int bin_cnt_y,
+      float bin_size_x,
+      float bin_size_y,
+      int num_threads = 1);
   ~FFT();
 
   // input func
@@ -26,16 +32,12 @@ class FFT
 
  private:
   // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
+  // Rows point into one contiguous block per array.
   float** bin_density_ = nullptr;
   float** electro_phi_ = nullptr;
   float** electro_field_x_ = nullptr;
   float** electro_field_y_ = nullptr;
 
-  // cos/sin table (prev: w_2d)
-  // length:  max(binCntX, binCntY) * 3 / 2
-  std::vector<float> cs_table_;
-
   // wx. length:  binCntX_
   std::vector<float> wx_;
   std::vector<float> wx_square_;
@@ -44,14 +46,13 @@ class FFT
   std::vector<float> wy_;
   std::vector<float> wy_square_;
 
-  // work area for bit reversal (prev: ip)
-  // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
-  std::vector<int> work_area_;
-
   int bin_cnt_X_ = 0;
   int bin_cnt_y_ = 0;
   float bin_size_x_ = 0;
   float bin_size_y_ = 0;
+  int num_threads_ = 1;
+
+  DCT dct_;
 };
 
 //
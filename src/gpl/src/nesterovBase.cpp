@@ -57,6 +57,7 @@ static float getSecondNorm(const std::vector<FloatPoint>& a);
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
 
+#pragma omp declare simd
 static float fastExp(float exp);
 
 ////////////////////////////////////////////////
@@ -345,6 +346,14 @@ void GNet::updateBox()
   }
 }
 
+void GNet::setBox(int lx, int ly, int ux, int uy)
+{
+  lx_ = lx;
+  ly_ = ly;
+  ux_ = ux;
+  uy_ = uy;
+}
+
 int64_t GNet::getHpwl() const
 {
   if (ux_ < lx_) {  // dangling net
@@ -1290,9 +1299,51 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 //
 // * Note that wlCoeffX and wlCoeffY is 1/gamma
 // in ePlace paper.
+void NesterovBaseCommon::initWaArrays()
+{
+  wa_.nets.clear();
+  wa_.net_begin.clear();
+  wa_.pins.clear();
+  wa_.pin_net.clear();
+  wa_.nets.reserve(gNetStor_.size());
+  wa_.net_begin.reserve(gNetStor_.size() + 1);
+  wa_.pins.reserve(gPinStor_.size());
+  wa_.pin_net.reserve(gPinStor_.size());
+
+  for (GNet& gNet : gNetStor_) {
+    wa_.net_begin.push_back(wa_.pins.size());
+    for (GPin* gPin : gNet.getGPins()) {
+      wa_.pins.push_back(gPin);
+      wa_.pin_net.push_back(wa_.nets.size());
+    }
+    wa_.nets.push_back(&gNet);
+  }
+  wa_.net_begin.push_back(wa_.pins.size());
+
+  const size_t num_pins = wa_.pins.size();
+  wa_.cx.resize(num_pins);
+  wa_.cy.resize(num_pins);
+  wa_.min_exp_x.resize(num_pins);
+  wa_.max_exp_x.resize(num_pins);
+  wa_.min_exp_y.resize(num_pins);
+  wa_.max_exp_y.resize(num_pins);
+
+  const size_t num_nets = wa_.nets.size();
+  wa_.lx.resize(num_nets);
+  wa_.ly.resize(num_nets);
+  wa_.ux.resize(num_nets);
+  wa_.uy.resize(num_nets);
+
+  is_wa_stale_ = false;
+}
+
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
+  if (is_wa_stale_) {
+    initWaArrays();
+  }
+
   // clear all WA variables.
 #pragma omp parallel for num_threads(num_threads_)
   for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
@@ -1300,94 +1351,144 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
     gPin->clearWaVars();
   }
 
-  // If checks are very expensive, so short circuit them if debug is not enabled
-  bool debug_enabled = log_->debugCheck(GPL, "wlUpdateWA", 1);
+  const int num_nets = wa_.nets.size();
+  const int num_pins = wa_.pins.size();
+  const int* net_begin = wa_.net_begin.data();
+  const int* pin_net = wa_.pin_net.data();
+  int* cx = wa_.cx.data();
+  int* cy = wa_.cy.data();
+  int* lx = wa_.lx.data();
+  int* ly = wa_.ly.data();
+  int* ux = wa_.ux.data();
+  int* uy = wa_.uy.data();
+  float* min_exp_x = wa_.min_exp_x.data();
+  float* max_exp_x = wa_.max_exp_x.data();
+  float* min_exp_y = wa_.min_exp_y.data();
+  float* max_exp_y = wa_.max_exp_y.data();
+
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
-    // old-style loop for old OpenMP
+  for (int i = 0; i < num_pins; i++) {
+    cx[i] = wa_.pins[i]->cx();
+    cy[i] = wa_.pins[i]->cy();
+  }
 
+  // Same result as GNet::updateBox
+#pragma omp parallel for num_threads(num_threads_)
+  for (int n = 0; n < num_nets; n++) {
+    int net_lx = INT_MAX;
+    int net_ly = INT_MAX;
+    int net_ux = INT_MIN;
+    int net_uy = INT_MIN;
+    for (int i = net_begin[n]; i < net_begin[n + 1]; i++) {
+      net_lx = std::min(cx[i], net_lx);
+      net_ly = std::min(cy[i], net_ly);
+      net_ux = std::max(cx[i], net_ux);
+      net_uy = std::max(cy[i], net_uy);
+    }
+    lx[n] = net_lx;
+    ly[n] = net_ly;
+    ux[n] = net_ux;
+    uy[n] = net_uy;
+    wa_.nets[n]->setBox(net_lx, net_ly, net_ux, net_uy);
+  }
+
+  // The WA terms are shift invariant:
+  //
+  //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
+  //   -----------------    = -----------------
+  //   Sum(exp(x_i))          Sum(exp(x_i - C))
+  //
+  // So we shift to keep the exponential from overflowing.  Pins below
+  // minWireLengthForceBar get 0, which leaves the net sums unchanged.
+  const float force_bar = nbVars_.minWireLengthForceBar;
+#pragma omp parallel for simd num_threads(num_threads_)
+  for (int i = 0; i < num_pins; i++) {
+    const int n = pin_net[i];
+    const float expMinX = (lx[n] - cx[i]) * wlCoeffX;
+    const float expMaxX = (cx[i] - ux[n]) * wlCoeffX;
+    const float expMinY = (ly[n] - cy[i]) * wlCoeffY;
+    const float expMaxY = (cy[i] - uy[n]) * wlCoeffY;
+    min_exp_x[i] = (expMinX > force_bar) ? fastExp(expMinX) : 0.0f;
+    max_exp_x[i] = (expMaxX > force_bar) ? fastExp(expMaxX) : 0.0f;
+    min_exp_y[i] = (expMinY > force_bar) ? fastExp(expMinY) : 0.0f;
+    max_exp_y[i] = (expMaxY > force_bar) ? fastExp(expMaxY) : 0.0f;
+  }
+
+  // Summed in pin order so the results match the per-pin accumulation.
+#pragma omp parallel for num_threads(num_threads_)
+  for (int n = 0; n < num_nets; n++) {
+    float exp_min_sum_x = 0;
+    float x_exp_min_sum_x = 0;
+    float exp_max_sum_x = 0;
+    float x_exp_max_sum_x = 0;
+    float exp_min_sum_y = 0;
+    float y_exp_min_sum_y = 0;
+    float exp_max_sum_y = 0;
+    float y_exp_max_sum_y = 0;
+    for (int i = net_begin[n]; i < net_begin[n + 1]; i++) {
+      exp_min_sum_x += min_exp_x[i];
+      x_exp_min_sum_x += cx[i] * min_exp_x[i];
+      exp_max_sum_x += max_exp_x[i];
+      x_exp_max_sum_x += cx[i] * max_exp_x[i];
+      exp_min_sum_y += min_exp_y[i];
+      y_exp_min_sum_y += cy[i] * min_exp_y[i];
+      exp_max_sum_y += max_exp_y[i];
+      y_exp_max_sum_y += cy[i] * max_exp_y[i];
+    }
+
+    GNet* gNet = wa_.nets[n];
     gNet->clearWaVars();
-    gNet->updateBox();
+    gNet->addWaExpMinSumX(exp_min_sum_x);
+    gNet->addWaXExpMinSumX(x_exp_min_sum_x);
+    gNet->addWaExpMaxSumX(exp_max_sum_x);
+    gNet->addWaXExpMaxSumX(x_exp_max_sum_x);
+    gNet->addWaExpMinSumY(exp_min_sum_y);
+    gNet->addWaYExpMinSumY(y_exp_min_sum_y);
+    gNet->addWaExpMaxSumY(exp_max_sum_y);
+    gNet->addWaYExpMaxSumY(y_exp_max_sum_y);
+  }
 
-    for (auto& gPin : gNet->getGPins()) {
-      // The WA terms are shift invariant:
-      //
-      //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
-      //   -----------------    = -----------------
-      //   Sum(exp(x_i))          Sum(exp(x_i - C))
-      //
-      // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
-
-      // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (debug_enabled && gPin->getGCell()
-            && gPin->getGCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->getGCell()->getName(),
-                     gPin->minExpSumX());
-        }
-      }
+  // If checks are very expensive, so short circuit them if debug is not enabled
+  bool debug_enabled = log_->debugCheck(GPL, "wlUpdateWA", 1);
+  auto debug_pin = [this](const char* label, const GPin* gPin, float value) {
+    if (gPin->getGCell() && gPin->getGCell()->isInstance()) {
+      debugPrint(log_,
+                 GPL,
+                 "wlUpdateWA",
+                 1,
+                 "{} updated: {} {:g}",
+                 label,
+                 gPin->getGCell()->getName(),
+                 value);
+    }
+  };
 
-      // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (debug_enabled && gPin->getGCell()
-            && gPin->getGCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->getGCell()->getName(),
-                     gPin->maxExpSumX());
-        }
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < num_pins; i++) {
+    GPin* gPin = wa_.pins[i];
+    const int n = pin_net[i];
+    if ((lx[n] - cx[i]) * wlCoeffX > force_bar) {
+      gPin->setMinExpSumX(min_exp_x[i]);
+      if (debug_enabled) {
+        debug_pin("MinX", gPin, min_exp_x[i]);
       }
-
-      // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (debug_enabled && gPin->getGCell()
-            && gPin->getGCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->getGCell()->getName(),
-                     gPin->minExpSumY());
-        }
+    }
+    if ((cx[i] - ux[n]) * wlCoeffX > force_bar) {
+      gPin->setMaxExpSumX(max_exp_x[i]);
+      if (debug_enabled) {
+        debug_pin("MaxX", gPin, max_exp_x[i]);
       }
-
-      // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (debug_enabled && gPin->getGCell()
-            && gPin->getGCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->getGCell()->getName(),
-                     gPin->maxExpSumY());
-        }
+    }
+    if ((ly[n] - cy[i]) * wlCoeffY > force_bar) {
+      gPin->setMinExpSumY(min_exp_y[i]);
+      if (debug_enabled) {
+        debug_pin("MinY", gPin, min_exp_y[i]);
+      }
+    }
+    if ((cy[i] - uy[n]) * wlCoeffY > force_bar) {
+      gPin->setMaxExpSumY(max_exp_y[i]);
+      if (debug_enabled) {
+        debug_pin("MaxY", gPin, max_exp_y[i]);
       }
     }
   }
@@ -1539,12 +1640,16 @@ void NesterovBaseCommon::updateDbGCells()
     if (gCell->isInstance()) {
       for (Instance* inst : gCell->insts()) {
         odb::dbInst* db_inst = inst->dbInst();
+        const odb::Point prev_location = db_inst->getLocation();
         db_inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
 
         // pad awareness on X coordinates
         db_inst->setLocation(gCell->dCx() - inst->dx() / 2
                                  + pbc_->siteSizeX() * pbc_->getPadLeft(),
                              gCell->dCy() - inst->dy() / 2);
+        if (db_inst->getLocation() != prev_location) {
+          db_moved_insts_.insert(db_inst);
+        }
       }
     }
   }
@@ -1554,6 +1659,18 @@ void NesterovBaseCommon::updateDbGCells()
   }
 }
 
+std::optional<odb::PtrSet<odb::dbInst>>
+NesterovBaseCommon::takeDbMovedInsts()
+{
+  odb::PtrSet<odb::dbInst> moved_insts;
+  moved_insts.swap(db_moved_insts_);
+  if (db_changed_by_cbk_) {
+    db_changed_by_cbk_ = false;
+    return std::nullopt;
+  }
+  return moved_insts;
+}
+
 int64_t NesterovBaseCommon::getHpwl()
 {
   assert(omp_get_thread_num() == 0);
@@ -1629,6 +1746,7 @@ GCell* NesterovBaseCommon::getGCellByIndex(size_t idx)
 //
 void NesterovBaseCommon::fixPointers()
 {
+  is_wa_stale_ = true;
   nbc_gcells_.clear();
   gCellMap_.clear();
   db_inst_to_nbc_index_map_.clear();
@@ -2046,7 +2164,8 @@ NesterovBase::NesterovBase(
   std::unique_ptr<FFT> fft(new FFT(bg_.getBinCntX(),
                                    bg_.getBinCntY(),
                                    bg_.getBinSizeX(),
-                                   bg_.getBinSizeY()));
+                                   bg_.getBinSizeY(),
+                                   nbc_->getNumThreads()));
 
   fft_ = std::move(fft);
 
@@ -3381,6 +3500,8 @@ bool NesterovBase::revertToSnapshot()
 
 void NesterovBaseCommon::moveGCell(odb::dbInst* db_inst)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   auto it = db_inst_to_nbc_index_map_.find(db_inst);
   if (it == db_inst_to_nbc_index_map_.end()) {
     debugPrint(log_,
@@ -3400,6 +3521,8 @@ void NesterovBaseCommon::moveGCell(odb::dbInst* db_inst)
 
 void NesterovBaseCommon::resizeGCell(odb::dbInst* db_inst)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   auto it = db_inst_to_nbc_index_map_.find(db_inst);
   if (it == db_inst_to_nbc_index_map_.end()) {
     debugPrint(log_,
@@ -3562,6 +3685,8 @@ void NesterovBase::createCbkGCell(odb::dbInst* db_inst, size_t stor_index)
 
 size_t NesterovBaseCommon::createCbkGCell(odb::dbInst* db_inst)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   debugPrint(
       log_, GPL, "callbacks", 2, "NBC createCbkGCell {}", db_inst->getName());
   Instance pb_inst(db_inst, pbc_.get(), log_);
@@ -3584,6 +3709,8 @@ size_t NesterovBaseCommon::createCbkGCell(odb::dbInst* db_inst)
 
 void NesterovBaseCommon::createCbkGNet(odb::dbNet* db_net, bool skip_io_mode)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   debugPrint(log_, GPL, "callbacks", 3, "NBC createGNet");
   Net gpl_net(db_net, skip_io_mode);
   pb_nets_stor_.push_back(gpl_net);
@@ -3596,6 +3723,8 @@ void NesterovBaseCommon::createCbkGNet(odb::dbNet* db_net, bool skip_io_mode)
 
 void NesterovBaseCommon::createCbkITerm(odb::dbITerm* iTerm)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   debugPrint(log_, GPL, "callbacks", 3, "NBC createITerm");
   Pin gpl_pin(iTerm);
   pb_pins_stor_.push_back(gpl_pin);
@@ -3692,6 +3821,8 @@ bool NesterovBase::updateHandle(odb::dbInst* db_inst, size_t handle)
 std::optional<std::pair<odb::dbInst*, size_t>>
 NesterovBaseCommon::destroyCbkGCell(odb::dbInst* db_inst)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   auto it = db_inst_to_nbc_index_map_.find(db_inst);
   if (it == db_inst_to_nbc_index_map_.end()) {
     debugPrint(log_,
@@ -4006,6 +4137,8 @@ void NesterovBase::restoreRemovedFillers()
 
 void NesterovBaseCommon::destroyCbkGNet(odb::dbNet* db_net)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   debugPrint(log_, GPL, "callbacks", 3, "NBC destroyGNet");
   auto db_it = db_net_to_index_map_.find(db_net);
   if (db_it == db_net_to_index_map_.end()) {
@@ -4042,6 +4175,8 @@ void NesterovBaseCommon::destroyCbkGNet(odb::dbNet* db_net)
 
 void NesterovBaseCommon::destroyCbkITerm(odb::dbITerm* db_iterm)
 {
+  db_changed_by_cbk_ = true;
+  is_wa_stale_ = true;
   debugPrint(log_, GPL, "callbacks", 3, "NBC destroyITerm");
   auto db_it = db_iterm_to_index_map_.find(db_iterm);
   if (db_it != db_iterm_to_index_map_.end()) {
@@ -4380,6 +4515,7 @@ static float calculateBiVariateNormalCDF(biNormalParameters i)
 }
 //
 // https://codingforspeed.com/using-faster-exponential-approximation/
+#pragma omp declare simd
 static float fastExp(float exp)
 {
   exp = 1.0f + exp / 1024.0f;
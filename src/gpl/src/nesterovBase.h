@@ -21,6 +21,7 @@
 
 #include "boost/unordered/unordered_flat_map.hpp"
 #include "gpl/Replace.h"
+#include "odb/PtrSetMap.h"
 #include "odb/db.h"
 #include "placerBase.h"
 #include "point.h"
@@ -259,6 +260,7 @@ class GNet
   void addGPin(GPin* gPin);
   void clearGPins() { gPins_.clear(); }
   void updateBox();
+  void setBox(int lx, int ly, int ux, int uy);
   int64_t getHpwl() const;
 
   void setDontCare();
@@ -852,6 +854,9 @@ class NesterovBaseCommon
   int64_t getHpwl();
 
   void updateDbGCells();
+  // Instances whose location was changed by updateDbGCells since the last
+  // call, or nullopt if the db callbacks reported other edits in between.
+  std::optional<odb::PtrSet<odb::dbInst>> takeDbMovedInsts();
 
   // Number of threads of execution
   size_t getNumThreads() { return num_threads_; }
@@ -934,6 +939,38 @@ class NesterovBaseCommon
   int new_gcells_count_;
   int deleted_gcells_count_;
   nesterovDbCbk* db_cbk_{nullptr};
+  odb::PtrSet<odb::dbInst> db_moved_insts_;
+  bool db_changed_by_cbk_ = false;
+
+  // Structure-of-arrays copy of the pins of gNetStor_, grouped by net, so
+  // the kernels of updateWireLengthForceWA run over contiguous arrays.  The
+  // results are still stored in GPin and GNet for everything else.
+  struct WaArrays
+  {
+    std::vector<GNet*> nets;
+    // The pins of nets[i] are [net_begin[i], net_begin[i + 1]).
+    std::vector<int> net_begin;
+    std::vector<GPin*> pins;
+    std::vector<int> pin_net;
+
+    // per pin
+    std::vector<int> cx;
+    std::vector<int> cy;
+    std::vector<float> min_exp_x;
+    std::vector<float> max_exp_x;
+    std::vector<float> min_exp_y;
+    std::vector<float> max_exp_y;
+
+    // per net
+    std::vector<int> lx;
+    std::vector<int> ly;
+    std::vector<int> ux;
+    std::vector<int> uy;
+  };
+  void initWaArrays();
+  WaArrays wa_;
+  // Set when pins or nets are added or removed.
+  bool is_wa_stale_ = true;
 };
 
 // Stores instances belonging to a specific power domain
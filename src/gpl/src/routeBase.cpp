@@ -19,6 +19,7 @@
 #include "grt/GlobalRouter.h"
 #include "grt/Rudy.h"
 #include "nesterovBase.h"
+#include "odb/PtrSetMap.h"
 #include "odb/db.h"
 #include "odb/dbTypes.h"
 #include "utl/Logger.h"
@@ -390,7 +391,7 @@ void RouteBase::calculateRudyTiles()
 {
   nbc_->updateDbGCells();
   grt::Rudy* rudy = grouter_->getRudy();
-  rudy->calculateRudy();
+  updateRudy(rudy);
   tg_->setNumRoutingLayers(0);
 
   // update grid tile info
@@ -428,6 +429,42 @@ void RouteBase::calculateRudyTiles()
   }
 }
 
+// Only the nets of the instances moved since the previous call are
+// recomputed, unless too many of them changed for that to pay off.
+void RouteBase::updateRudy(grt::Rudy* rudy)
+{
+  const auto moved_insts = nbc_->takeDbMovedInsts();
+  if (!is_rudy_initialized_ || !moved_insts.has_value()) {
+    rudy->calculateRudy();
+    is_rudy_initialized_ = true;
+    return;
+  }
+
+  const size_t max_nets = nbc_->getGNets().size() / 4;
+  odb::PtrSet<odb::dbNet> nets;
+  for (odb::dbInst* inst : *moved_insts) {
+    for (odb::dbITerm* iterm : inst->getITerms()) {
+      odb::dbNet* net = iterm->getNet();
+      if (net != nullptr) {
+        nets.insert(net);
+      }
+    }
+    if (nets.size() > max_nets) {
+      rudy->calculateRudy();
+      return;
+    }
+  }
+
+  debugPrint(log_,
+             GPL,
+             "rudy",
+             1,
+             "Incremental RUDY update of {} nets from {} moved instances",
+             nets.size(),
+             moved_insts->size());
+  rudy->updateRudy(nets);
+}
+
 // fill
 //
 // TileGrids'
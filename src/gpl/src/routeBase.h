@@ -14,6 +14,7 @@ class dbDatabase;
 
 namespace grt {
 class GlobalRouter;
+class Rudy;
 }
 
 namespace utl {
@@ -205,6 +206,8 @@ class RouteBase
   int min_RC_violated_cnt_ = 0;
   int max_routability_no_improvement_ = 3;
   int max_routability_revert_ = 50;
+  // Set once grt's Rudy holds the demand of every net of this placement.
+  bool is_rudy_initialized_ = false;
 
   void init();
   void resetRoutabilityResources();
@@ -213,6 +216,8 @@ class RouteBase
   // update revert_count_
   void increaseCounter();
 
+  void updateRudy(grt::Rudy* rudy);
+
   // routability funcs
   void initGCells();
 };
@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+// Times the density solver transforms (the forward ddct2d plus the three
+// inverse transforms done by FFT::doFFT) with the Ooura 2D routines and with
+// gpl::DCT, and reports the largest relative difference between the two.  Sizes that
+// are not a power of two only run through gpl::DCT and report the round trip
+// error instead.
+//
+// usage: dct_benchmark [num_threads] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/dct.h"
+#include "src/gpl/src/fft.h"
+
+namespace {
+
+// n1 x n2 array with row pointers as used by the Ooura routines.
+class Grid
+{
+ public:
+  Grid(int n1, int n2) : data_(n1 * n2), rows_(n1)
+  {
+    for (int i = 0; i < n1; i++) {
+      rows_[i] = data_.data() + i * n2;
+    }
+  }
+
+  Grid(const Grid&) = delete;
+  Grid& operator=(const Grid&) = delete;
+
+  float** rows() { return rows_.data(); }
+  std::vector<float>& data() { return data_; }
+
+ private:
+  std::vector<float> data_;
+  std::vector<float*> rows_;
+};
+
+bool isPowerOfTwo(int n)
+{
+  return (n & (n - 1)) == 0;
+}
+
+// Largest difference relative to the largest magnitude in a.
+float maxDiff(const std::vector<float>& a, const std::vector<float>& b)
+{
+  float diff = 0;
+  float scale = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    diff = std::max(diff, std::abs(a[i] - b[i]));
+    scale = std::max(scale, std::abs(a[i]));
+  }
+  return (scale > 0) ? diff / scale : diff;
+}
+
+template <typename Func>
+double timeMs(int iterations, Func func)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    func();
+  }
+  const std::chrono::duration<double, std::milli> elapsed
+      = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+void runOoura(int n1,
+              int n2,
+              Grid& grid,
+              std::vector<int>& ip,
+              std::vector<float>& w)
+{
+  float** a = grid.rows();
+  gpl::ddct2d(n1, n2, -1, a, nullptr, ip.data(), w.data());
+  gpl::ddct2d(n1, n2, 1, a, nullptr, ip.data(), w.data());
+  gpl::ddsct2d(n1, n2, 1, a, nullptr, ip.data(), w.data());
+  gpl::ddcst2d(n1, n2, 1, a, nullptr, ip.data(), w.data());
+}
+
+void runDct(gpl::DCT& dct, Grid& grid)
+{
+  using Kind = gpl::DCT::Kind;
+  float** a = grid.rows();
+  dct.transform(a, -1, Kind::kCos, Kind::kCos);
+  dct.transform(a, 1, Kind::kCos, Kind::kCos);
+  dct.transform(a, 1, Kind::kSin, Kind::kCos);
+  dct.transform(a, 1, Kind::kCos, Kind::kSin);
+}
+
+// Forward then scaled inverse DCT should give back the input.
+float roundTripError(gpl::DCT& dct, int n1, int n2, Grid& grid)
+{
+  using Kind = gpl::DCT::Kind;
+  const std::vector<float> input = grid.data();
+  float** a = grid.rows();
+  dct.transform(a, -1, Kind::kCos, Kind::kCos);
+  for (int i = 0; i < n1; i++) {
+    a[i][0] *= 0.5;
+  }
+  for (int j = 0; j < n2; j++) {
+    a[0][j] *= 0.5;
+  }
+  dct.transform(a, 1, Kind::kCos, Kind::kCos);
+  for (float& value : grid.data()) {
+    value *= 4.0 / n1 / n2;
+  }
+  return maxDiff(input, grid.data());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const int num_threads = (argc > 1) ? std::atoi(argv[1]) : 1;
+  const int iterations = (argc > 2) ? std::atoi(argv[2]) : 20;
+
+  const std::vector<std::pair<int, int>> sizes = {{128, 128},
+                                                  {256, 256},
+                                                  {512, 512},
+                                                  {1024, 1024},
+                                                  {1024, 256},
+                                                  {384, 384},
+                                                  {600, 400}};
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+  std::cout << fmt::format("threads: {}, iterations: {}\n\n",
+                           num_threads,
+                           iterations);
+  std::cout << fmt::format("{:>11} {:>11} {:>11} {:>8} {:>11}\n",
+                           "size",
+                           "ooura (ms)",
+                           "dct (ms)",
+                           "speedup",
+                           "rel diff");
+
+  for (const auto& [n1, n2] : sizes) {
+    Grid input(n1, n2);
+    for (float& value : input.data()) {
+      value = dist(rng);
+    }
+
+    gpl::DCT dct(n1, n2, num_threads);
+    Grid dct_grid(n1, n2);
+    const double dct_ms = timeMs(iterations, [&] {
+      dct_grid.data() = input.data();
+      runDct(dct, dct_grid);
+    });
+
+    const std::string size = fmt::format("{}x{}", n1, n2);
+    if (!isPowerOfTwo(n1) || !isPowerOfTwo(n2)) {
+      Grid round_trip(n1, n2);
+      round_trip.data() = input.data();
+      std::cout << fmt::format("{:>11} {:>11} {:11.3f} {:>8} {:11.3g}\n",
+                               size,
+                               "-",
+                               dct_ms,
+                               "-",
+                               roundTripError(dct, n1, n2, round_trip));
+      continue;
+    }
+
+    const int n = std::max(n1, n2);
+    std::vector<int> ip(std::lround(std::sqrt(n)) + 2, 0);
+    std::vector<float> w(n * 3 / 2, 0);
+    Grid ooura_grid(n1, n2);
+    const double ooura_ms = timeMs(iterations, [&] {
+      ooura_grid.data() = input.data();
+      runOoura(n1, n2, ooura_grid, ip, w);
+    });
+
+    std::cout << fmt::format("{:>11} {:11.3f} {:11.3f} {:7.2f}x {:11.3g}\n",
+                             size,
+                             ooura_ms,
+                             dct_ms,
+                             ooura_ms / dct_ms,
+                             maxDiff(ooura_grid.data(), dct_grid.data()));
+  }
+
+  return 0;
+}
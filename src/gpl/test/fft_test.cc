@@ -1,11 +1,16 @@
 #include "src/gpl/src/fft.h"
 
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <numbers>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/dct.h"
 
 namespace {
 
@@ -146,4 +151,117 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+// An n1 x n2 array with rows in one block, as used by FFT.
+class Array2D
+{
+ public:
+  Array2D(int n1, int n2) : n1_(n1), n2_(n2), data_(n1 * n2) {}
+
+  std::vector<float*> rows()
+  {
+    std::vector<float*> rows(n1_);
+    for (int i = 0; i < n1_; i++) {
+      rows[i] = data_.data() + i * n2_;
+    }
+    return rows;
+  }
+  float& at(int i, int j) { return data_[i * n2_ + j]; }
+
+  void fillPattern()
+  {
+    for (int i = 0; i < n1_; i++) {
+      for (int j = 0; j < n2_; j++) {
+        at(i, j) = std::sin(1.0 + 0.7 * i + 1.3 * j) + 0.25 * i;
+      }
+    }
+  }
+
+ private:
+  int n1_;
+  int n2_;
+  std::vector<float> data_;
+};
+
+// Forward ddct/ddst basis for sample j and frequency k of length n.  The
+// ddst frequency n is stored at k = 0.
+double forwardBasis(gpl::DCT::Kind kind, int j, int k, int n)
+{
+  constexpr double kPi = std::numbers::pi;
+  if (kind == gpl::DCT::Kind::kCos) {
+    return std::cos(kPi * (j + 0.5) * k / n);
+  }
+  const int freq = (k == 0) ? n : k;
+  return std::sin(kPi * (j + 0.5) * freq / n);
+}
+
+// The basis matrix path for non power of two sizes matches the transform
+// definition.
+TEST(DCTTest, NonPowerOfTwoMatchesDefinition)
+{
+  using Kind = gpl::DCT::Kind;
+  constexpr int n1 = 6;
+  constexpr int n2 = 5;
+  const std::pair<Kind, Kind> kinds[]
+      = {{Kind::kCos, Kind::kCos},
+         {Kind::kSin, Kind::kCos},
+         {Kind::kCos, Kind::kSin}};
+  for (const auto& [kind1, kind2] : kinds) {
+    Array2D a(n1, n2);
+    a.fillPattern();
+    Array2D input = a;
+    gpl::DCT dct(n1, n2, 2);
+    dct.transform(a.rows().data(), -1, kind1, kind2);
+
+    for (int k1 = 0; k1 < n1; k1++) {
+      for (int k2 = 0; k2 < n2; k2++) {
+        double expected = 0;
+        for (int i = 0; i < n1; i++) {
+          for (int j = 0; j < n2; j++) {
+            expected += input.at(i, j) * forwardBasis(kind1, i, k1, n1)
+                        * forwardBasis(kind2, j, k2, n2);
+          }
+        }
+        EXPECT_NEAR(a.at(k1, k2), expected, 1e-4);
+      }
+    }
+  }
+}
+
+// A forward transform followed by the scaled inverse restores the input,
+// with one dimension on the Ooura path and the other on the basis path.
+TEST(DCTTest, NonPowerOfTwoRoundTrip)
+{
+  using Kind = gpl::DCT::Kind;
+  const std::pair<int, int> sizes[] = {{6, 5}, {8, 5}, {5, 8}};
+  const std::pair<Kind, Kind> kinds[]
+      = {{Kind::kCos, Kind::kCos},
+         {Kind::kSin, Kind::kCos},
+         {Kind::kCos, Kind::kSin}};
+  for (const auto& [n1, n2] : sizes) {
+    for (const auto& [kind1, kind2] : kinds) {
+      Array2D a(n1, n2);
+      a.fillPattern();
+      Array2D input = a;
+      gpl::DCT dct(n1, n2, 2);
+      dct.transform(a.rows().data(), -1, kind1, kind2);
+      // The inverse expects the first coefficient of each dimension halved.
+      for (int j = 0; j < n2; j++) {
+        a.at(0, j) *= 0.5;
+      }
+      for (int i = 0; i < n1; i++) {
+        a.at(i, 0) *= 0.5;
+      }
+      dct.transform(a.rows().data(), 1, kind1, kind2);
+
+      const float scale = 4.0 / (n1 * n2);
+      for (int i = 0; i < n1; i++) {
+        for (int j = 0; j < n2; j++) {
+          EXPECT_NEAR(a.at(i, j) * scale, input.at(i, j), 1e-4)
+              << n1 << "x" << n2 << " at " << i << ", " << j;
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
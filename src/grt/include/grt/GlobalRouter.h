@@ -185,6 +185,10 @@ class GlobalRouter
   void saveGuides(const std::vector<odb::dbNet*>& nets);
   void writeSegments(const char* file_name);
   void readSegments(const char* file_name);
+  // Binary checkpoint of the FastRoute capacities, pin grid positions and
+  // routes. It is only read back into the same design and settings.
+  void writeCheckpoint(const char* file_name);
+  bool readCheckpoint(const char* file_name);
   bool netIsCovered(odb::dbNet* db_net, std::string& pins_not_covered);
   bool segmentIsLine(const GSegment& segment);
   bool segmentCoversPin(const GSegment& segment, const Pin& pin);
@@ -352,10 +356,14 @@ class GlobalRouter
 
  private:
   void finishGlobalRouting(bool save_guides = false);
+  void restoreRoutesResources();
+  uint64_t computeCheckpointSignature();
   // Net functions
-  Net* addNet(odb::dbNet* db_net);
+  // The on grid pin positions are left to the caller when find_pins is false.
+  Net* addNet(odb::dbNet* db_net, bool find_pins = true);
   void removeNet(odb::dbNet* db_net);
   void updateNetPins(Net* net);
+  void makeNetPins(Net* net);
 
   void getCongestionNets(odb::PtrSet<odb::dbNet>& congestion_nets);
   void applyAdjustments(int min_routing_layer, int max_routing_layer);
@@ -375,7 +383,10 @@ class GlobalRouter
                            int track_count,
                            bool horizontal);
   odb::Rect getGCellRect(int x, int y);
-  void initNetlist(std::vector<Net*>& nets, bool incremental = false);
+  // Pin access resources are only added when the capacities are built from
+  // scratch, not for incremental routing or restored checkpoints.
+  void initNetlist(std::vector<Net*>& nets,
+                   bool add_pin_access_resources = true);
   void computeNetDegree(const std::vector<Net*>& nets,
                         int& min_degree,
                         int& max_degree);
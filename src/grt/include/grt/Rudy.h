@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include <vector>
 
 #include "odb/db.h"
@@ -28,13 +29,14 @@ class Rudy
    public:
     odb::Rect getRect() const { return rect_; }
     void setRect(int lx, int ly, int ux, int uy);
-    void addRudy(float rudy);
+    void addRudy(double rudy);
     float getRudy() const { return rudy_; }
     void clearRudy() { rudy_ = 0.0; }
 
    private:
     odb::Rect rect_;
-    float rudy_ = 0;
+    // Accumulated in double so that incremental updates don't drift.
+    double rudy_ = 0;
   };
 
   explicit Rudy(odb::dbBlock* block, grt::GlobalRouter* grouter);
@@ -46,6 +48,14 @@ class Rudy
   void calculateRudy(std::optional<odb::PtrSet<odb::dbNet>*> selection
                      = std::nullopt);
 
+  /**
+   * Replaces the contribution of the given nets, e.g. the nets of the
+   * instances moved since the last calculation, using their current
+   * locations. Runs a full `calculateRudy` if the last one was restricted
+   * to a selection of nets, and after every `kMaxIncrementalUpdates` calls.
+   * */
+  void updateRudy(const odb::PtrSet<odb::dbNet>& nets);
+
   /**
    * Set the grid area and grid numbers.
    * Default value will be the die area of block and (40, 40), respectively.
@@ -71,7 +81,8 @@ class Rudy
   void getResourceReductions();
   Tile& getEditableTile(int x, int y) { return grid_.at(x).at(y); }
   void processNet(odb::dbNet* net);
-  void processIntersectionSignalNet(odb::Rect net_rect);
+  // weight is -1 to remove a previously added net.
+  void processIntersectionSignalNet(odb::Rect net_rect, float weight = 1.0f);
 
   odb::dbBlock* block_;
   odb::Rect grid_block_;
@@ -81,6 +92,12 @@ class Rudy
   int wire_width_ = 100;
   int tile_size_ = 0;
   std::vector<std::vector<Tile>> grid_;
+  // Bounding box each signal net was last added with.
+  std::unordered_map<odb::dbNet*, odb::Rect> net_rects_;
+  bool has_all_nets_ = false;
+  // Incremental updates since the last full calculation.
+  int incremental_updates_ = 0;
+  static constexpr int kMaxIncrementalUpdates = 16;
 };
 
 }  // namespace grt
@@ -118,6 +118,7 @@ void GlobalRouter::setNumThreads(int num_threads)
 {
   num_threads_ = num_threads;
   fastroute_->setNumThreads(num_threads_);
+  cugr_->setNumThreads(num_threads_);
 }
 
 void GlobalRouter::setSnapshotBatchedWidth(int snapshot_batched_width)
@@ -439,6 +440,8 @@ void GlobalRouter::endIncremental(bool save_guides)
 void GlobalRouter::globalRoute(bool save_guides)
 {
   utl::Timer timer;
+  // Time spent building the grid, capacities, obstructions and nets.
+  double setup_runtime = 0;
   bool has_routable_nets = false;
 
   for (auto net : db_->getChip()->getBlock()->getNets()) {
@@ -464,6 +467,7 @@ void GlobalRouter::globalRoute(bool save_guides)
 
     if (use_cugr_) {
       std::vector<Net*> nets = initCUGR(min_layer, max_layer);
+      setup_runtime = timer.elapsed();
       if (verbose_) {
         reportResources();
       }
@@ -473,6 +477,7 @@ void GlobalRouter::globalRoute(bool save_guides)
       addRemainingGuides(routes_, nets, min_layer, max_layer);
     } else {
       std::vector<Net*> nets = initFastRoute(min_layer, max_layer);
+      setup_runtime = timer.elapsed();
       if (verbose_) {
         reportResources();
       }
@@ -487,12 +492,21 @@ void GlobalRouter::globalRoute(bool save_guides)
 
   finishGlobalRouting(save_guides);
   if (verbose_) {
-    const int elapsed = static_cast<int>(timer.elapsed());
-    const int hour = elapsed / 3600;
-    const int min = (elapsed % 3600) / 60;
-    const int sec = elapsed % 60;
+    auto format_runtime = [](double seconds) {
+      const int elapsed = static_cast<int>(seconds);
+      return fmt::format("{:02}:{:02}:{:02}",
+                         elapsed / 3600,
+                         (elapsed % 3600) / 60,
+                         elapsed % 60);
+    };
+    const double elapsed = timer.elapsed();
     logger_->info(
-        GRT, 303, "Global routing runtime = {:02}:{:02}:{:02}", hour, min, sec);
+        GRT, 303, "Global routing runtime = {}", format_runtime(elapsed));
+    logger_->info(GRT,
+                  309,
+                  "Setup runtime = {}, routing runtime = {}",
+                  format_runtime(setup_runtime),
+                  format_runtime(elapsed - setup_runtime));
   }
 }
 
@@ -564,6 +578,36 @@ void GlobalRouter::suggestAdjustment()
   }
 }
 
+// Repopulate edge usage from routes_ using updateNetResources, which
+// uses layer_edge_cost (essential to NDR nets). Applies soft NDR if
+// there is too much congestion
+void GlobalRouter::restoreRoutesResources()
+{
+  std::vector<std::pair<odb::dbNet*, int>> ndr_nets;
+  int net_id;
+  bool exists;
+  for (const auto& [db_net, groute] : routes_) {
+    if (!isDetailedRouted(db_net)) {
+      auto it = db_net_map_.find(db_net);
+      if (it != db_net_map_.end()) {
+        updateNetResources(it->second, false);
+        // Mark the net so congestion-loop releases use the matching
+        // GRoute-based path (updateNetResources) rather than the
+        // sttree-based clearNetRoute (which sees empty sttrees here
+        // and would leave the 3D usage un-released, causing underflow).
+        it->second->setAreSegmentsRestored(true);
+        if (db_net->getNonDefaultRule() != nullptr) {
+          fastroute_->getNetId(db_net, net_id, exists);
+          ndr_nets.emplace_back(db_net, net_id);
+        }
+      }
+    }
+  }
+  // Disable the extra edge cost for NDR nets on congested 2D edges.
+  // Uses routes_ segments directly since sttrees are not yet populated.
+  disableCongestedNDRNetsFromRoutes(ndr_nets);
+}
+
 void GlobalRouter::updateDbCongestion()
 {
   int min_layer, max_layer;
@@ -592,32 +636,7 @@ int GlobalRouter::repairAntennas(odb::dbMTerm* diode_mterm,
     int min_layer, max_layer;
     getMinMaxLayer(min_layer, max_layer);
     initFastRoute(min_layer, max_layer);
-    // Repopulate edge usage from routes_ using updateNetResources, which
-    // uses layer_edge_cost (essential to NDR nets). Applies soft NDR if
-    // there is too much congestion
-    std::vector<std::pair<odb::dbNet*, int>> ndr_nets;
-    int net_id;
-    bool exists;
-    for (const auto& [db_net, groute] : routes_) {
-      if (!isDetailedRouted(db_net)) {
-        auto it = db_net_map_.find(db_net);
-        if (it != db_net_map_.end()) {
-          updateNetResources(it->second, false);
-          // Mark the net so congestion-loop releases use the matching
-          // GRoute-based path (updateNetResources) rather than the
-          // sttree-based clearNetRoute (which sees empty sttrees here
-          // and would leave the 3D usage un-released, causing underflow).
-          it->second->setAreSegmentsRestored(true);
-          if (db_net->getNonDefaultRule() != nullptr) {
-            fastroute_->getNetId(db_net, net_id, exists);
-            ndr_nets.emplace_back(db_net, net_id);
-          }
-        }
-      }
-    }
-    // Disable the extra edge cost for NDR nets on congested 2D edges.
-    // Uses routes_ segments directly since sttrees are not yet populated.
-    disableCongestedNDRNetsFromRoutes(ndr_nets);
+    restoreRoutesResources();
   }
   if (repair_antennas_ == nullptr) {
     repair_antennas_
@@ -893,8 +912,10 @@ void GlobalRouter::setCapacities(int min_routing_layer, int max_routing_layer)
     const bool horizontal
         = tech_layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL;
 
+    // Every (x, y) sets its own edge, so rows and columns run in parallel.
     if (tech_layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL) {
       int min_cap = kBigInt;
+#pragma omp parallel for num_threads(num_threads_) reduction(min : min_cap)
       for (int y = 1; y <= y_grids; y++) {
         for (int x = 1; x < x_grids; x++) {
           int cap = 0;
@@ -912,6 +933,7 @@ void GlobalRouter::setCapacities(int min_routing_layer, int max_routing_layer)
       fastroute_->addHCapacity(min_cap, layer);
     } else {
       int min_cap = kBigInt;
+#pragma omp parallel for num_threads(num_threads_) reduction(min : min_cap)
       for (int x = 1; x <= x_grids; x++) {
         for (int y = 1; y < y_grids; y++) {
           int cap = 0;
@@ -1496,7 +1518,7 @@ void GlobalRouter::computePinPositionOnGrid(
   // this way, the result based on drt APs is maintained
   if (!has_access_points && pinOverlapsWithSingleTrack(pin, pos_on_grid)) {
     const int conn_layer = pin.getConnectionLayer();
-    odb::dbTechLayer* layer = routing_layers_[conn_layer];
+    odb::dbTechLayer* layer = routing_layers_.at(conn_layer);
     pos_on_grid = grid_->getPositionOnGrid(pos_on_grid);
     if (!(pos_on_grid == odb::Point(pin_position.x(), pin_position.y()))
         && ((layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL
@@ -1664,7 +1686,8 @@ void GlobalRouter::reportMacrosAndBlockages()
   logger_->info(GRT, 4, "Blockages: {}", blockages_cnt);
 }
 
-void GlobalRouter::initNetlist(std::vector<Net*>& nets, bool incremental)
+void GlobalRouter::initNetlist(std::vector<Net*>& nets,
+                               bool add_pin_access_resources)
 {
   pad_pins_connections_.clear();
 
@@ -1693,7 +1716,7 @@ void GlobalRouter::initNetlist(std::vector<Net*>& nets, bool incremental)
   // Add resources for pin access in macro/pad pins after defining their on grid
   // position. It must be done only in the initialization of the tool, not
   // during incremental.
-  if (has_macros_or_pads_ && !incremental) {
+  if (has_macros_or_pads_ && add_pin_access_resources) {
     addResourcesForPinAccess(nets);
   }
   fastroute_->initAuxVar();
@@ -2011,6 +2034,7 @@ void GlobalRouter::computeUserLayerAdjustments(const int min_routing_layer,
     if (adjustment != 0) {
       if (tech_layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL
           && inside_layer_range) {
+#pragma omp parallel for num_threads(num_threads_)
         for (int y = 1; y <= y_grids; y++) {
           for (int x = 1; x < x_grids; x++) {
             int edge_cap
@@ -2028,6 +2052,7 @@ void GlobalRouter::computeUserLayerAdjustments(const int min_routing_layer,
 
       if (tech_layer->getDirection() == odb::dbTechLayerDir::VERTICAL
           && inside_layer_range) {
+#pragma omp parallel for num_threads(num_threads_)
         for (int x = 1; x <= x_grids; x++) {
           for (int y = 1; y < y_grids; y++) {
             int edge_cap
@@ -2076,6 +2101,7 @@ void GlobalRouter::computeRegionAdjustments(const odb::Rect& region,
   int last_tile_reduce = grid_->computeTileReduce(
       region, last_tile_box, track_space, false, routing_layer->getDirection());
 
+#pragma omp parallel for num_threads(num_threads_)
   for (int x = first_tile.getX(); x <= last_tile.getX(); x++) {
     for (int y = first_tile.getY(); y <= last_tile.getY(); y++) {
       double edge_cap
@@ -3398,6 +3424,410 @@ void GlobalRouter::readSegments(const char* file_name)
   }
 }
 
+template <typename T>
+static void writeBinary(std::ostream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readBinary(std::istream& in, T& value)
+{
+  return static_cast<bool>(
+      in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+static constexpr uint32_t kCheckpointMagic = 0x54435247;  // "GRCT"
+static constexpr uint32_t kCheckpointVersion = 2;
+
+// FNV-1a hash of everything the saved capacities and routes depend on:
+// routing settings, grid, placement, blockages, pre-routed wires and
+// connectivity. It reads only the db and the settings, so a checkpoint can
+// be checked before the current routing state is cleared.
+uint64_t GlobalRouter::computeCheckpointSignature()
+{
+  uint64_t hash = 14695981039346656037ULL;
+  auto add_bytes = [&hash](const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+  };
+  auto add = [&](auto value) { add_bytes(&value, sizeof(value)); };
+  auto add_name = [&](const char* name) {
+    add_bytes(name, std::strlen(name) + 1);
+  };
+  auto add_rect = [&](const odb::Rect& rect) {
+    add(rect.xMin());
+    add(rect.yMin());
+    add(rect.xMax());
+    add(rect.yMax());
+  };
+
+  add(getMinRoutingLayer());
+  add(getMaxRoutingLayer());
+  add(getMinLayerForClock());
+  add(getMaxLayerForClock());
+  add(adjustment_);
+  add(macro_extension_);
+  add(infinite_capacity_);
+  add(caps_perturbation_percentage_);
+  add(perturbation_amount_);
+  add(seed_);
+  add(skip_large_fanout_);
+  for (RegionAdjustment region_adjustment : region_adjustments_) {
+    add_rect(region_adjustment.getRegion());
+    add(region_adjustment.getLayer());
+    add(region_adjustment.getAdjustment());
+  }
+  int min_layer, max_layer;
+  getMinMaxLayer(min_layer, max_layer);
+  odb::dbTech* tech = db_->getTech();
+  for (int level = 1; level <= max_layer; level++) {
+    odb::dbTechLayer* tech_layer = tech->findRoutingLayer(level);
+    add(level);
+    add(tech_layer->getLayerAdjustment());
+    add(tech_layer->getDirection().getValue());
+    odb::dbTrackGrid* track_grid = block_->findTrackGrid(tech_layer);
+    if (track_grid != nullptr) {
+      int track_step, track_init, num_tracks;
+      track_grid->getAverageTrackSpacing(track_step, track_init, num_tracks);
+      add(track_step);
+      add(track_init);
+      add(num_tracks);
+    }
+  }
+  add_rect(block_->getDieArea());
+  add(block_->getGCellTileSize());
+
+  for (odb::dbInst* inst : block_->getInsts()) {
+    add_name(inst->getMaster()->getConstName());
+    const odb::Point location = inst->getLocation();
+    add(location.x());
+    add(location.y());
+    add(inst->getOrient().getValue());
+  }
+  for (odb::dbBTerm* bterm : block_->getBTerms()) {
+    for (odb::dbBPin* bpin : bterm->getBPins()) {
+      for (odb::dbBox* box : bpin->getBoxes()) {
+        add_rect(box->getBox());
+        add(box->getTechLayer()->getNumber());
+      }
+    }
+  }
+  for (odb::dbObstruction* obstruction : block_->getObstructions()) {
+    odb::dbBox* box = obstruction->getBBox();
+    add_rect(box->getBox());
+    add(box->getTechLayer()->getNumber());
+  }
+  for (odb::dbNet* db_net : block_->getNets()) {
+    add_name(db_net->getConstName());
+    add(db_net->getSigType().getValue());
+    add(db_net->isSpecial());
+    for (odb::dbITerm* iterm : db_net->getITerms()) {
+      add_name(iterm->getInst()->getConstName());
+      add_name(iterm->getMTerm()->getConstName());
+    }
+    for (odb::dbBTerm* bterm : db_net->getBTerms()) {
+      add_name(bterm->getConstName());
+    }
+    uint32_t wire_cnt = 0, via_cnt = 0;
+    db_net->getWireCount(wire_cnt, via_cnt);
+    add(wire_cnt);
+    add(via_cnt);
+  }
+
+  return hash;
+}
+
+void GlobalRouter::writeCheckpoint(const char* file_name)
+{
+  if (use_cugr_) {
+    logger_->error(
+        GRT, 310, "Global routing checkpoints are not supported with CUGR.");
+  }
+  if (!initialized_ || routes_.empty()) {
+    logger_->error(
+        GRT, 311, "Run global_route before writing a global route checkpoint.");
+  }
+
+  std::ofstream out(file_name, std::ios::binary);
+  if (!out) {
+    logger_->error(GRT,
+                   312,
+                   "Global routing checkpoint file {} could not be opened.",
+                   file_name);
+  }
+
+  writeBinary(out, kCheckpointMagic);
+  writeBinary(out, kCheckpointVersion);
+  writeBinary(out, computeCheckpointSignature());
+  // Length-prefixed so the reader can validate the whole file before it
+  // rebuilds the grid the capacities are loaded into.
+  std::ostringstream capacities;
+  fastroute_->writeCapacities(capacities);
+  const std::string capacities_data = std::move(capacities).str();
+  writeBinary(out, static_cast<uint64_t>(capacities_data.size()));
+  out.write(capacities_data.data(), capacities_data.size());
+  writeBinary(out, is_congested_);
+  writeBinary(out, has_macros_or_pads_);
+
+  std::vector<Net*> nets;
+  nets.reserve(db_net_map_.size());
+  for (const auto& [db_net, net] : db_net_map_) {
+    nets.push_back(net);
+  }
+  std::ranges::sort(nets, [](const Net* a, const Net* b) {
+    return a->getName() < b->getName();
+  });
+
+  writeBinary(out, static_cast<uint32_t>(nets.size()));
+  for (Net* net : nets) {
+    const std::string name = net->getName();
+    writeBinary(out, static_cast<uint32_t>(name.size()));
+    out.write(name.data(), name.size());
+
+    const std::vector<Pin>& pins = net->getPins();
+    writeBinary(out, static_cast<uint32_t>(pins.size()));
+    for (const Pin& pin : pins) {
+      const odb::Point& pos = pin.getOnGridPosition();
+      const int32_t pin_pos[] = {pos.x(), pos.y(), pin.getConnectionLayer()};
+      writeBinary(out, pin_pos);
+    }
+
+    auto iter = routes_.find(net->getDbNet());
+    const uint32_t num_segments
+        = iter == routes_.end() ? 0 : iter->second.size();
+    writeBinary(out, num_segments);
+    for (uint32_t i = 0; i < num_segments; i++) {
+      const GSegment& segment = iter->second[i];
+      const int32_t coords[] = {segment.init_x,
+                                segment.init_y,
+                                segment.init_layer,
+                                segment.final_x,
+                                segment.final_y,
+                                segment.final_layer};
+      writeBinary(out, coords);
+      const uint8_t flags = (segment.isJumper() ? 1 : 0)
+                            | (segment.is3DRoute() ? 2 : 0);
+      writeBinary(out, flags);
+    }
+  }
+
+  if (!out) {
+    logger_->error(GRT,
+                   313,
+                   "Failed to write global routing checkpoint file {}.",
+                   file_name);
+  }
+}
+
+bool GlobalRouter::readCheckpoint(const char* file_name)
+{
+  if (db_->getChip() == nullptr || db_->getChip()->getBlock() == nullptr
+      || db_->getTech() == nullptr) {
+    logger_->error(
+        GRT, 314, "Load design before reading a global routing checkpoint.");
+  }
+  if (use_cugr_) {
+    logger_->error(
+        GRT, 319, "Global routing checkpoints are not supported with CUGR.");
+  }
+
+  std::ifstream in(file_name, std::ios::binary);
+  if (!in) {
+    logger_->error(GRT,
+                   320,
+                   "Global routing checkpoint file {} could not be opened.",
+                   file_name);
+  }
+  auto corrupted = [this, file_name]() {
+    logger_->error(
+        GRT, 315, "Global routing checkpoint file {} is corrupted.", file_name);
+  };
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  if (!readBinary(in, magic) || magic != kCheckpointMagic) {
+    corrupted();
+  }
+  if (!readBinary(in, version) || version != kCheckpointVersion) {
+    logger_->warn(GRT,
+                  316,
+                  "Global routing checkpoint {} has version {}, expected {}. "
+                  "Ignoring it.",
+                  file_name,
+                  version,
+                  kCheckpointVersion);
+    return false;
+  }
+
+  // Validate the whole header before the current routing is dropped.
+  block_ = db_->getChip()->getBlock();
+  uint64_t signature = 0;
+  if (!readBinary(in, signature)) {
+    corrupted();
+  }
+  if (signature != computeCheckpointSignature()) {
+    logger_->warn(GRT,
+                  317,
+                  "Global routing checkpoint {} does not match the current "
+                  "design or settings. Ignoring it.",
+                  file_name);
+    return false;
+  }
+
+  // Parse the rest of the file before anything is dropped, so a corrupted
+  // file leaves the current routing untouched.
+  struct CheckpointNet
+  {
+    odb::dbNet* db_net;
+    std::vector<std::array<int32_t, 3>> pins;
+    GRoute route;
+  };
+
+  const std::streampos body_begin = in.tellg();
+  in.seekg(0, std::ios::end);
+  const std::streamoff file_size = in.tellg();
+  in.seekg(body_begin);
+  // Rejects counts that can't fit in the rest of the file before they are
+  // used to allocate.
+  auto fits = [&in, file_size](uint64_t count, uint64_t item_size) {
+    return count <= uint64_t(file_size - in.tellg()) / item_size;
+  };
+
+  uint64_t capacities_size = 0;
+  if (!readBinary(in, capacities_size) || !fits(capacities_size, 1)) {
+    corrupted();
+  }
+  std::string capacities_data(capacities_size, '\0');
+  bool is_congested = false;
+  bool has_macros_or_pads = false;
+  uint32_t num_nets = 0;
+  if (!in.read(capacities_data.data(), capacities_size)
+      || !readBinary(in, is_congested) || !readBinary(in, has_macros_or_pads)
+      || !readBinary(in, num_nets)
+      || !fits(num_nets, 3 * sizeof(uint32_t))) {
+    corrupted();
+  }
+
+  std::vector<CheckpointNet> checkpoint_nets;
+  checkpoint_nets.reserve(num_nets);
+  for (uint32_t n = 0; n < num_nets; n++) {
+    uint32_t name_size = 0;
+    if (!readBinary(in, name_size) || !fits(name_size, 1)) {
+      corrupted();
+    }
+    std::string name(name_size, '\0');
+    in.read(name.data(), name_size);
+    odb::dbNet* db_net = in ? block_->findNet(name.c_str()) : nullptr;
+    if (db_net == nullptr) {
+      corrupted();
+    }
+    CheckpointNet& net = checkpoint_nets.emplace_back();
+    net.db_net = db_net;
+
+    uint32_t num_pins = 0;
+    if (!readBinary(in, num_pins)
+        || !fits(num_pins, sizeof(std::array<int32_t, 3>))) {
+      corrupted();
+    }
+    net.pins.resize(num_pins);
+    for (std::array<int32_t, 3>& pin_pos : net.pins) {
+      if (!readBinary(in, pin_pos)) {
+        corrupted();
+      }
+    }
+
+    uint32_t num_segments = 0;
+    if (!readBinary(in, num_segments)
+        || !fits(num_segments, 6 * sizeof(int32_t) + sizeof(uint8_t))) {
+      corrupted();
+    }
+    net.route.reserve(num_segments);
+    for (uint32_t i = 0; i < num_segments; i++) {
+      int32_t coords[6];
+      uint8_t flags = 0;
+      if (!readBinary(in, coords) || !readBinary(in, flags)) {
+        corrupted();
+      }
+      GSegment& segment = net.route.emplace_back(coords[0],
+                                                 coords[1],
+                                                 coords[2],
+                                                 coords[3],
+                                                 coords[4],
+                                                 coords[5],
+                                                 (flags & 1) != 0);
+      segment.setIs3DRoute((flags & 2) != 0);
+    }
+  }
+  if (in.peek() != std::istream::traits_type::eof()) {
+    corrupted();
+  }
+
+  clear();
+  h_nets_in_pos_.clear();
+  v_nets_in_pos_.clear();
+
+  // The signature matched, so the rebuilt router agrees with the file unless
+  // the signature collided; then drop the half restored state.
+  auto mismatch = [this, &corrupted]() {
+    clear();
+    corrupted();
+  };
+
+  // Only the grid is rebuilt; capacities and adjustments come from the file.
+  int min_layer, max_layer;
+  getMinMaxLayer(min_layer, max_layer);
+  configFastRoute();
+  initRoutingLayers(min_layer, max_layer);
+  initRoutingTracks(max_layer);
+  initCoreGrid(max_layer);
+  mirrorGridToFastRoute(max_layer);
+
+  fastroute_->initEdges();
+  std::istringstream capacities(std::move(capacities_data));
+  if (!fastroute_->readCapacities(capacities)
+      || capacities.peek() != std::istream::traits_type::eof()) {
+    mismatch();
+  }
+  fastroute_->initLowerBoundCapacities();
+  fastroute_->initEdgesCapacityPerLayer();
+
+  std::vector<Net*> nets = initNets(false);
+  for (CheckpointNet& checkpoint_net : checkpoint_nets) {
+    auto net_iter = db_net_map_.find(checkpoint_net.db_net);
+    if (net_iter == db_net_map_.end()
+        || net_iter->second->getPins().size() != checkpoint_net.pins.size()) {
+      mismatch();
+    }
+    std::vector<Pin>& pins = net_iter->second->getPins();
+    for (size_t i = 0; i < pins.size(); i++) {
+      const std::array<int32_t, 3>& pin_pos = checkpoint_net.pins[i];
+      pins[i].setOnGridPosition(odb::Point(pin_pos[0], pin_pos[1]));
+      pins[i].setConnectionLayer(pin_pos[2]);
+    }
+    if (!checkpoint_net.route.empty()) {
+      routes_[checkpoint_net.db_net] = std::move(checkpoint_net.route);
+    }
+  }
+
+  // The saved capacities already hold the pin access resources.
+  has_macros_or_pads_ = has_macros_or_pads;
+  initNetlist(nets, /*add_pin_access_resources=*/false);
+  is_congested_ = is_congested;
+  initialized_ = true;
+
+  restoreRoutesResources();
+  updateDbCongestion();
+  logger_->info(GRT,
+                318,
+                "Restored the global routing of {} nets from {}.",
+                routes_.size(),
+                file_name);
+  return true;
+}
+
 bool GlobalRouter::netIsCovered(odb::dbNet* db_net,
                                 std::string& pins_not_covered)
 {
@@ -4360,7 +4790,7 @@ bool GlobalRouter::pinOverlapsWithSingleTrack(const Pin& pin,
   int conn_layer = pin.getConnectionLayer();
   std::vector<odb::Rect> pin_boxes = pin.getBoxes().at(conn_layer);
 
-  odb::dbTechLayer* layer = routing_layers_[conn_layer];
+  odb::dbTechLayer* layer = routing_layers_.at(conn_layer);
   RoutingTracks tracks = getRoutingTracksByIndex(conn_layer);
 
   odb::Rect pin_rect;
@@ -4687,6 +5117,7 @@ std::vector<Net*> GlobalRouter::findNets(bool init_clock_nets)
     db_nets = nets_to_route_;
   }
   std::vector<Net*> clk_nets;
+  std::vector<Net*> new_nets;
   const int large_fanout_threshold = 1000;
   for (odb::dbNet* db_net : db_nets) {
     const bool is_special
@@ -4709,9 +5140,10 @@ std::vector<Net*> GlobalRouter::findNets(bool init_clock_nets)
                     db_net->getTermCount());
     }
 
-    Net* net = addNet(db_net);
+    Net* net = addNet(db_net, false);
     // add clock nets not connected to a leaf first
     if (net) {
+      new_nets.push_back(net);
       bool is_non_leaf_clock = isNonLeafClock(net->getDbNet());
       if (is_non_leaf_clock) {
         net->setIsClockNet(true);
@@ -4720,6 +5152,12 @@ std::vector<Net*> GlobalRouter::findNets(bool init_clock_nets)
     }
   }
 
+  // The on grid pin positions of a net only depend on its own pins.
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < static_cast<int>(new_nets.size()); i++) {
+    findPins(new_nets[i]);
+  }
+
   std::vector<Net*> non_clk_nets;
   for (auto [ignored, net] : db_net_map_) {
     bool is_non_leaf_clock = isNonLeafClock(net->getDbNet());
@@ -4749,7 +5187,7 @@ void GlobalRouter::findClockNets(const std::vector<Net*>& nets,
   }
 }
 
-Net* GlobalRouter::addNet(odb::dbNet* db_net)
+Net* GlobalRouter::addNet(odb::dbNet* db_net, bool find_pins)
 {
   if (!db_net->getSigType().isSupply() && !db_net->isSpecial()
       && db_net->getSWires().empty() && !db_net->isConnectedByAbutment()) {
@@ -4758,7 +5196,11 @@ Net* GlobalRouter::addNet(odb::dbNet* db_net)
       delete db_net_map_[db_net];
     }
     db_net_map_[db_net] = net;
-    updateNetPins(net);
+    if (find_pins) {
+      updateNetPins(net);
+    } else {
+      makeNetPins(net);
+    }
     return net;
   }
   return nullptr;
@@ -4835,12 +5277,17 @@ void GlobalRouter::removeNet(odb::dbNet* db_net)
 }
 
 void GlobalRouter::updateNetPins(Net* net)
+{
+  makeNetPins(net);
+  findPins(net);
+}
+
+void GlobalRouter::makeNetPins(Net* net)
 {
   odb::dbNet* db_net = net->getDbNet();
   net->destroyPins();
   makeItermPins(net, db_net, grid_->getGridArea());
   makeBtermPins(net, db_net, grid_->getGridArea());
-  findPins(net);
 }
 
 Net* GlobalRouter::getNet(odb::dbNet* db_net)
@@ -5234,37 +5681,41 @@ int GlobalRouter::findInstancesObstructions(
     const std::vector<int>& layer_extensions,
     std::map<int, std::vector<odb::Rect>>& layer_obs_map)
 {
-  int obstructions_cnt = 0;
-  int pin_out_of_die_count = 0;
+  // A shape that blocks routing resources. Pin shapes keep their mterm for
+  // the die area check.
+  struct InstShape
+  {
+    odb::Rect rect;
+    odb::dbTechLayer* tech_layer;
+    odb::dbMTerm* mterm;
+  };
+  struct InstShapes
+  {
+    std::vector<InstShape> shapes;
+    int obstructions_cnt = 0;
+  };
+
   odb::dbTech* tech = db_->getTech();
-  for (odb::dbInst* inst : block_->getInsts()) {
-    odb::dbMaster* master = inst->getMaster();
+  const int min_layer = getMinRoutingLayer();
+  const int max_layer = getMaxRoutingLayer();
 
+  auto find_shapes = [&](odb::dbInst* inst, InstShapes& inst_shapes) {
+    odb::dbMaster* master = inst->getMaster();
     const odb::dbTransform transform = inst->getTransform();
 
-    bool is_macro = false;
     if (master->isBlock()) {
-      is_macro = true;
-      has_macros_or_pads_ = true;
-    }
-
-    if (master->getType().isPad()) {
-      has_macros_or_pads_ = true;
-    }
-
-    if (is_macro) {
       std::unordered_map<int, std::vector<odb::Rect>> macro_obs_per_layer;
       int bottom_layer = std::numeric_limits<int>::max();
       int top_layer = std::numeric_limits<int>::min();
 
       for (odb::dbBox* box : master->getObstructions()) {
         int layer = box->getTechLayer()->getRoutingLevel();
-        if (getMinRoutingLayer() <= layer && layer <= getMaxRoutingLayer()) {
+        if (min_layer <= layer && layer <= max_layer) {
           odb::Rect rect = box->getBox();
           transform.apply(rect);
 
           macro_obs_per_layer[layer].push_back(rect);
-          obstructions_cnt++;
+          inst_shapes.obstructions_cnt++;
 
           bottom_layer = std::min(bottom_layer, layer);
           top_layer = std::max(top_layer, layer);
@@ -5273,7 +5724,6 @@ int GlobalRouter::findInstancesObstructions(
 
       extendObstructions(macro_obs_per_layer, bottom_layer, top_layer);
 
-      // iterate all Rects for each layer and apply adjustment in FastRoute
       for (auto& [layer, obs] : macro_obs_per_layer) {
         odb::dbTechLayer* tech_layer = tech->findRoutingLayer(layer);
         int layer_extension = layer_extensions[layer];
@@ -5287,71 +5737,99 @@ int GlobalRouter::findInstancesObstructions(
             cur_obs.set_xlo(cur_obs.xMin() - layer_extension);
             cur_obs.set_xhi(cur_obs.xMax() + layer_extension);
           }
-          layer_obs_map[layer].push_back(cur_obs);
-          applyObstructionAdjustment(
-              cur_obs, tech->findRoutingLayer(layer), is_macro);
+          inst_shapes.shapes.push_back({cur_obs, tech_layer, nullptr});
         }
       }
     } else {
       for (odb::dbBox* box : master->getObstructions()) {
         int layer = box->getTechLayer()->getRoutingLevel();
-        if (getMinRoutingLayer() <= layer && layer <= getMaxRoutingLayer()) {
+        if (min_layer <= layer && layer <= max_layer) {
           odb::Rect rect = box->getBox();
           transform.apply(rect);
-
-          odb::Point lower_bound = odb::Point(rect.xMin(), rect.yMin());
-          odb::Point upper_bound = odb::Point(rect.xMax(), rect.yMax());
-          odb::Rect obstruction_rect = odb::Rect(lower_bound, upper_bound);
-          if (!die_area.contains(obstruction_rect)) {
-            if (verbose_) {
-              logger_->warn(GRT,
-                            38,
-                            "Found blockage outside die area in instance {}.",
-                            inst->getConstName());
-            }
-          }
-          odb::dbTechLayer* tech_layer = box->getTechLayer();
-          applyObstructionAdjustment(obstruction_rect, tech_layer);
-          obstructions_cnt++;
+          inst_shapes.shapes.push_back({rect, box->getTechLayer(), nullptr});
+          inst_shapes.obstructions_cnt++;
         }
       }
     }
 
     for (odb::dbMTerm* mterm : master->getMTerms()) {
       for (odb::dbMPin* mpin : mterm->getMPins()) {
-        odb::Point lower_bound;
-        odb::Point upper_bound;
-        odb::Rect pin_box;
-        int pin_layer;
-
         for (odb::dbBox* box : mpin->getGeometry()) {
-          odb::Rect rect = box->getBox();
-          transform.apply(rect);
-
           odb::dbTechLayer* tech_layer = box->getTechLayer();
           if (!tech_layer
               || tech_layer->getType() != odb::dbTechLayerType::ROUTING) {
             continue;
           }
 
-          pin_layer = tech_layer->getRoutingLevel();
-          if (getMinRoutingLayer() <= pin_layer
-              && pin_layer <= getMaxRoutingLayer()) {
-            lower_bound = odb::Point(rect.xMin(), rect.yMin());
-            upper_bound = odb::Point(rect.xMax(), rect.yMax());
-            pin_box = odb::Rect(lower_bound, upper_bound);
-            if (!die_area.contains(pin_box)
-                && !mterm->getSigType().isSupply()) {
+          const int pin_layer = tech_layer->getRoutingLevel();
+          if (min_layer <= pin_layer && pin_layer <= max_layer) {
+            odb::Rect pin_box = box->getBox();
+            transform.apply(pin_box);
+            inst_shapes.shapes.push_back({pin_box, tech_layer, mterm});
+          }
+        }
+      }
+    }
+  };
+
+  std::vector<odb::dbInst*> insts;
+  insts.reserve(block_->getInsts().size());
+  for (odb::dbInst* inst : block_->getInsts()) {
+    insts.push_back(inst);
+  }
+
+  // The shapes are collected in parallel, one window of instances at a time,
+  // and applied serially in instance order because an adjustment reads the
+  // capacity left by the previous ones.
+  constexpr int kWindowSize = 1 << 14;
+  const int num_insts = insts.size();
+  int obstructions_cnt = 0;
+  int pin_out_of_die_count = 0;
+  std::vector<InstShapes> window_shapes;
+  for (int begin = 0; begin < num_insts; begin += kWindowSize) {
+    const int end = std::min(begin + kWindowSize, num_insts);
+    window_shapes.assign(end - begin, InstShapes());
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 16)
+    for (int i = begin; i < end; i++) {
+      find_shapes(insts[i], window_shapes[i - begin]);
+    }
+
+    for (int i = begin; i < end; i++) {
+      odb::dbInst* inst = insts[i];
+      odb::dbMaster* master = inst->getMaster();
+      const bool is_macro = master->isBlock();
+      if (is_macro || master->getType().isPad()) {
+        has_macros_or_pads_ = true;
+      }
+
+      const InstShapes& inst_shapes = window_shapes[i - begin];
+      obstructions_cnt += inst_shapes.obstructions_cnt;
+      for (const InstShape& shape : inst_shapes.shapes) {
+        if (shape.mterm != nullptr) {
+          if (!die_area.contains(shape.rect)
+              && !shape.mterm->getSigType().isSupply()) {
+            logger_->warn(GRT,
+                          39,
+                          "Found pin {} outside die area in instance {}.",
+                          shape.mterm->getConstName(),
+                          inst->getConstName());
+            pin_out_of_die_count++;
+          }
+          applyObstructionAdjustment(shape.rect, shape.tech_layer);
+        } else if (is_macro) {
+          layer_obs_map[shape.tech_layer->getRoutingLevel()].push_back(
+              shape.rect);
+          applyObstructionAdjustment(shape.rect, shape.tech_layer, is_macro);
+        } else {
+          if (!die_area.contains(shape.rect)) {
+            if (verbose_) {
               logger_->warn(GRT,
-                            39,
-                            "Found pin {} outside die area in instance {}.",
-                            mterm->getConstName(),
+                            38,
+                            "Found blockage outside die area in instance {}.",
                             inst->getConstName());
-              pin_out_of_die_count++;
             }
-            odb::dbTechLayer* tech_layer = box->getTechLayer();
-            applyObstructionAdjustment(pin_box, tech_layer);
           }
+          applyObstructionAdjustment(shape.rect, shape.tech_layer);
         }
       }
     }
@@ -5375,31 +5853,33 @@ void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
     logger_->error(GRT, 94, "Design with no nets.");
   }
 
-  for (odb::dbNet* db_net : nets) {
+  using NetShape = std::pair<odb::Rect, odb::dbTechLayer*>;
+  auto find_shapes = [](odb::dbNet* db_net, std::vector<NetShape>& shapes) {
     uint32_t wire_cnt = 0, via_cnt = 0;
     db_net->getWireCount(wire_cnt, via_cnt);
     if (wire_cnt == 0) {
-      continue;
+      return;
     }
 
     std::vector<odb::dbShape> via_boxes;
+    auto add_via_boxes = [&]() {
+      for (const odb::dbShape& box : via_boxes) {
+        odb::dbTechLayer* tech_layer = box.getTechLayer();
+        if (tech_layer->getRoutingLevel() == 0) {
+          continue;
+        }
+        shapes.emplace_back(box.getBox(), tech_layer);
+      }
+    };
+
     if (db_net->getSigType().isSupply()) {
       for (odb::dbSWire* swire : db_net->getSWires()) {
         for (odb::dbSBox* s : swire->getWires()) {
           if (s->isVia()) {
             s->getViaBoxes(via_boxes);
-            for (const odb::dbShape& box : via_boxes) {
-              odb::dbTechLayer* tech_layer = box.getTechLayer();
-              if (tech_layer->getRoutingLevel() == 0) {
-                continue;
-              }
-              odb::Rect via_rect = box.getBox();
-              applyNetObstruction(via_rect, tech_layer, die_area, db_net);
-            }
+            add_via_boxes();
           } else {
-            odb::Rect wire_rect = s->getBox();
-            odb::dbTechLayer* tech_layer = s->getTechLayer();
-            applyNetObstruction(wire_rect, tech_layer, die_area, db_net);
+            shapes.emplace_back(s->getBox(), s->getTechLayer());
           }
         }
       }
@@ -5414,23 +5894,39 @@ void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
           const odb::dbShape& shape = pshape.shape;
           if (shape.isVia()) {
             odb::dbShape::getViaBoxes(shape, via_boxes);
-            for (const odb::dbShape& box : via_boxes) {
-              odb::dbTechLayer* tech_layer = box.getTechLayer();
-              if (tech_layer->getRoutingLevel() == 0) {
-                continue;
-              }
-              odb::Rect via_rect = box.getBox();
-              applyNetObstruction(via_rect, tech_layer, die_area, db_net);
-            }
+            add_via_boxes();
           } else {
-            odb::Rect wire_rect = shape.getBox();
-            odb::dbTechLayer* tech_layer = shape.getTechLayer();
-
-            applyNetObstruction(wire_rect, tech_layer, die_area, db_net);
+            shapes.emplace_back(shape.getBox(), shape.getTechLayer());
           }
         }
       }
     }
+  };
+
+  std::vector<odb::dbNet*> db_nets;
+  db_nets.reserve(nets.size());
+  for (odb::dbNet* db_net : nets) {
+    db_nets.push_back(db_net);
+  }
+
+  // As for instances, the wires are decoded in parallel and applied in net
+  // order. Routed nets carry many shapes, hence the smaller window.
+  constexpr int kWindowSize = 1 << 12;
+  const int num_nets = db_nets.size();
+  std::vector<std::vector<NetShape>> window_shapes;
+  for (int begin = 0; begin < num_nets; begin += kWindowSize) {
+    const int end = std::min(begin + kWindowSize, num_nets);
+    window_shapes.assign(end - begin, {});
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 16)
+    for (int i = begin; i < end; i++) {
+      find_shapes(db_nets[i], window_shapes[i - begin]);
+    }
+
+    for (int i = begin; i < end; i++) {
+      for (const auto& [rect, tech_layer] : window_shapes[i - begin]) {
+        applyNetObstruction(rect, tech_layer, die_area, db_nets[i]);
+      }
+    }
   }
 }
 
@@ -6497,7 +6993,7 @@ void GlobalRouter::getCongestionNets(odb::PtrSet<odb::dbNet>& congestion_nets)
 
 void GlobalRouter::initFastRouteIncr(std::vector<Net*>& nets)
 {
-  initNetlist(nets, true);
+  initNetlist(nets, /*add_pin_access_resources=*/false);
   fastroute_->initAuxVar();
   fastroute_->setIncrementalGrt(true);
 }
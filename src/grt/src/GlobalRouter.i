@@ -311,6 +311,16 @@ void read_segments(const char* file_name)
   getGlobalRouter()->readSegments(file_name);
 }
 
+void write_checkpoint(const char* file_name)
+{
+  getGlobalRouter()->writeCheckpoint(file_name);
+}
+
+bool read_checkpoint(const char* file_name)
+{
+  return getGlobalRouter()->readCheckpoint(file_name);
+}
+
 void write_pin_locations(const char* file_name)
 {
   getGlobalRouter()->writePinLocations(file_name);
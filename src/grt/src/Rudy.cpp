@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <optional>
 #include <set>
+#include <unordered_map>
 #include <utility>
 
 #include "grt/GRoute.h"
@@ -125,6 +126,10 @@ void Rudy::calculateRudy(std::optional<odb::PtrSet<odb::dbNet>*> selection)
     }
   }
 
+  net_rects_.clear();
+  has_all_nets_ = !selection.has_value();
+  incremental_updates_ = 0;
+
   getResourceReductions();
 
   if (selection.has_value()) {
@@ -138,16 +143,36 @@ void Rudy::calculateRudy(std::optional<odb::PtrSet<odb::dbNet>*> selection)
   }
 }
 
+void Rudy::updateRudy(const odb::PtrSet<odb::dbNet>& nets)
+{
+  // Resync periodically to bound the rounding left by add/remove pairs.
+  if (!has_all_nets_ || incremental_updates_ >= kMaxIncrementalUpdates) {
+    calculateRudy();
+    return;
+  }
+  incremental_updates_++;
+
+  for (odb::dbNet* net : nets) {
+    auto it = net_rects_.find(net);
+    if (it != net_rects_.end()) {
+      processIntersectionSignalNet(it->second, -1.0f);
+    }
+    processNet(net);
+  }
+}
+
 void Rudy::processNet(odb::dbNet* net)
 {
   // refer: https://ieeexplore.ieee.org/document/4211973
   if (!net->getSigType().isSupply()) {
     const auto net_rect = net->getTermBBox();
+    net_rects_[net] = net_rect;
     processIntersectionSignalNet(net_rect);
   }
 }
 
-void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
+void Rudy::processIntersectionSignalNet(const odb::Rect net_rect,
+                                        const float weight)
 {
   if (net_rect.isInverted()) {
     return;
@@ -159,7 +184,7 @@ void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
   }
   const auto hpwl = static_cast<float>(net_rect.dx() + net_rect.dy());
   const auto wire_area = hpwl * wire_width_;
-  const auto net_congestion = wire_area / net_area;
+  const auto net_congestion = weight * wire_area / net_area;
 
   // Calculate the intersection range
   const int min_x_index
@@ -201,7 +226,7 @@ void Rudy::Tile::setRect(int lx, int ly, int ux, int uy)
   rect_ = odb::Rect(lx, ly, ux, uy);
 }
 
-void Rudy::Tile::addRudy(float rudy)
+void Rudy::Tile::addRudy(double rudy)
 {
   rudy_ += rudy;
 }
@@ -40,6 +40,8 @@ class Design;
 class GridGraph;
 class GRNet;
 class BoxT;
+template <typename Type>
+class GridGraphView;
 
 struct Constants
 {
@@ -97,6 +99,7 @@ class CUGR
   {
     congestion_iterations_ = iterations;
   }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
   void addDirtyNet(odb::dbNet* net);
   void updateNet(odb::dbNet* net);
   void removeNet(odb::dbNet* net);
@@ -155,6 +158,23 @@ class CUGR
 
   void patternRoute(std::vector<int>& net_indices);
   void patternRouteWithDetours(std::vector<int>& net_indices);
+  /**
+   * @brief Pattern-routes nets in order on `num_threads_` threads.
+   *
+   * Nets are taken in windows of consecutive indices. Within a window each
+   * net is assigned a level one above the highest level of any earlier
+   * net whose routing DAG footprint (grown by one gcell for via patches)
+   * overlaps its own. Nets of one level touch disjoint edges, so they are
+   * routed concurrently and committed in their original order. The result
+   * is identical to routing the nets one after the other.
+   *
+   * @param net_indices     Nets to route, in routing order.
+   * @param congestion_view When set, detours are added around the
+   *                        congested edges in this view and each net's
+   *                        previous routing is ripped up first (stage 2).
+   */
+  void patternRouteNets(const std::vector<int>& net_indices,
+                        GridGraphView<bool>* congestion_view);
   void mazeRoute(std::vector<int>& net_indices);
 
   /**
@@ -226,6 +246,7 @@ class CUGR
 
   float critical_nets_percentage_ = 0;
   int congestion_iterations_ = 5;
+  int num_threads_ = 1;
 
   std::vector<int> nets_to_route_;
 };
@@ -41,6 +41,7 @@
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
 #include "utl/ServiceRegistry.h"
+#include "utl/ThreadPool.h"
 
 using utl::GRT;
 
@@ -232,30 +233,7 @@ void CUGR::patternRoute(std::vector<int>& net_indices)
   }
 
   sortNetIndices(net_indices);
-  for (const int net_index : net_indices) {
-    if (gr_nets_[net_index] == nullptr) {
-      continue;
-    }
-    if (gr_nets_[net_index]->getNumPins() < 2) {
-      continue;
-    }
-    if (gr_nets_[net_index] == nullptr) {
-      continue;
-    }
-    PatternRoute pattern_route(gr_nets_[net_index].get(),
-                               grid_graph_.get(),
-                               stt_builder_,
-                               constants_,
-                               logger_);
-    pattern_route.constructSteinerTree();
-    pattern_route.constructRoutingDAG();
-    pattern_route.run();
-    if (gr_nets_[net_index] == nullptr) {
-      continue;
-    }
-    grid_graph_->addTreeUsage(gr_nets_[net_index]->getRoutingTree(),
-                              gr_nets_[net_index]->getNdrCosts());
-  }
+  patternRouteNets(net_indices, nullptr);
 
   updateCongestedNets(net_indices);
 }
@@ -275,26 +253,154 @@ void CUGR::patternRouteWithDetours(std::vector<int>& net_indices)
   GridGraphView<bool> congestion_view;
   grid_graph_->extractCongestionView(congestion_view);
   sortNetIndices(net_indices);
+  patternRouteNets(net_indices, &congestion_view);
+
+  updateCongestedNets(net_indices);
+}
+
+void CUGR::patternRouteNets(const std::vector<int>& net_indices,
+                            GridGraphView<bool>* congestion_view)
+{
+  const bool detours = congestion_view != nullptr;
+  std::vector<GRNet*> nets;
+  nets.reserve(net_indices.size());
   for (const int net_index : net_indices) {
-    if (gr_nets_[net_index] == nullptr) {
-      continue;
-    }
     GRNet* net = gr_nets_[net_index].get();
-    if (net->getNumPins() < 2) {
-      continue;
+    if (net != nullptr && net->getNumPins() >= 2) {
+      nets.push_back(net);
     }
-    grid_graph_->removeTreeUsage(net->getRoutingTree(), net->getNdrCosts());
-    PatternRoute pattern_route(
+  }
+
+  auto make_route = [&](GRNet* net) {
+    auto pattern_route = std::make_unique<PatternRoute>(
         net, grid_graph_.get(), stt_builder_, constants_, logger_);
-    pattern_route.constructSteinerTree();
-    pattern_route.constructRoutingDAG();
-    // KEY DIFFERENCE compared to stage 1 (patternRoute)
-    pattern_route.constructDetours(congestion_view);
-    pattern_route.run();
-    grid_graph_->addTreeUsage(net->getRoutingTree(), net->getNdrCosts());
+    pattern_route->constructSteinerTree();
+    pattern_route->constructRoutingDAG();
+    if (detours) {
+      // KEY DIFFERENCE compared to stage 1 (patternRoute)
+      pattern_route->constructDetours(*congestion_view);
+    }
+    return pattern_route;
+  };
+
+  if (num_threads_ <= 1) {
+    for (GRNet* net : nets) {
+      if (detours) {
+        grid_graph_->removeTreeUsage(net->getRoutingTree(),
+                                     net->getNdrCosts());
+      }
+      make_route(net)->run();
+      grid_graph_->addTreeUsage(net->getRoutingTree(), net->getNdrCosts());
+    }
+    return;
   }
 
-  updateCongestedNets(net_indices);
+  // FLUTE fills its lookup table on first use, up to degree 8 and then to
+  // degree 9 for the first net that needs it. A degree 9 net fills all of
+  // it before the threads share it.
+  stt_builder_->flute(
+      {0, 1, 2, 3, 4, 5, 6, 7, 8}, {0, 5, 1, 6, 2, 7, 3, 8, 4}, 3);
+
+  // Bounds the number of routing DAGs alive at once.
+  constexpr int kWindowSize = 1 << 16;
+  const int x_size = grid_graph_->getXSize();
+  const int y_size = grid_graph_->getYSize();
+  // Per gcell: the last window that touched it and one above the highest
+  // level that did.
+  std::vector<int> cell_window(x_size * y_size, -1);
+  std::vector<int> cell_level(x_size * y_size, 0);
+  utl::ThreadPool pool(num_threads_);
+  // Runs func(i) for i in [0, count) in a few chunks per thread to balance
+  // uneven nets without queueing one task per net.
+  auto parallel_for = [&](const int count, const auto& func) {
+    const int chunk_size = std::max(1, count / (num_threads_ * 8));
+    std::vector<int> chunk_begins;
+    for (int i = 0; i < count; i += chunk_size) {
+      chunk_begins.push_back(i);
+    }
+    pool.parallelFor(chunk_begins, [&](const int chunk_begin) {
+      const int chunk_end = std::min(count, chunk_begin + chunk_size);
+      for (int i = chunk_begin; i < chunk_end; i++) {
+        func(i);
+      }
+    });
+  };
+  int num_levels = 0;
+
+  for (int begin = 0; begin < nets.size(); begin += kWindowSize) {
+    const int window = begin / kWindowSize;
+    const int size = std::min<int>(kWindowSize, nets.size() - begin);
+    std::vector<std::unique_ptr<PatternRoute>> routes(size);
+    std::vector<BoxT> footprints(size);
+
+    parallel_for(size, [&](const int i) {
+      GRNet* net = nets[begin + i];
+      routes[i] = make_route(net);
+      BoxT box = routes[i]->getRoutingDAGBox();
+      if (detours) {
+        // The previous routing is ripped up, so its edges are written too.
+        GRTreeNode::preorder(net->getRoutingTree(),
+                             [&box](const std::shared_ptr<GRTreeNode>& node) {
+                               box.update(*node);
+                             });
+      }
+      // Vias also read and write the edges just below their gcell.
+      footprints[i].set(std::max(box.lx() - 1, 0),
+                        std::max(box.ly() - 1, 0),
+                        std::min(box.hx() + 1, x_size - 1),
+                        std::min(box.hy() + 1, y_size - 1));
+    });
+
+    std::vector<std::vector<int>> levels;
+    for (int i = 0; i < size; i++) {
+      const BoxT& box = footprints[i];
+      int level = 0;
+      for (int x = box.lx(); x <= box.hx(); x++) {
+        for (int y = box.ly(); y <= box.hy(); y++) {
+          const int cell = x * y_size + y;
+          if (cell_window[cell] == window) {
+            level = std::max(level, cell_level[cell]);
+          }
+        }
+      }
+      for (int x = box.lx(); x <= box.hx(); x++) {
+        for (int y = box.ly(); y <= box.hy(); y++) {
+          const int cell = x * y_size + y;
+          cell_window[cell] = window;
+          cell_level[cell] = level + 1;
+        }
+      }
+      if (level == levels.size()) {
+        levels.emplace_back();
+      }
+      levels[level].push_back(i);
+    }
+    num_levels += levels.size();
+
+    for (const std::vector<int>& level : levels) {
+      if (detours) {
+        for (const int i : level) {
+          GRNet* net = nets[begin + i];
+          grid_graph_->removeTreeUsage(net->getRoutingTree(),
+                                       net->getNdrCosts());
+        }
+      }
+      parallel_for(level.size(), [&](const int j) { routes[level[j]]->run(); });
+      for (const int i : level) {
+        GRNet* net = nets[begin + i];
+        grid_graph_->addTreeUsage(net->getRoutingTree(), net->getNdrCosts());
+        routes[i].reset();
+      }
+    }
+  }
+  debugPrint(logger_,
+             GRT,
+             "cugr_threads",
+             1,
+             "Pattern routed {} nets in {} levels on {} threads.",
+             nets.size(),
+             num_levels,
+             num_threads_);
 }
 
 void CUGR::mazeRoute(std::vector<int>& net_indices)
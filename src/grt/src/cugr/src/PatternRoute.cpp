@@ -528,6 +528,27 @@ void PatternRoute::constructDetours(GridGraphView<bool>& congestion_view)
   }
 }
 
+BoxT PatternRoute::getRoutingDAGBox() const
+{
+  BoxT box;
+  std::vector<bool> visited(num_dag_nodes_, false);
+  std::function<void(const std::shared_ptr<PatternRoutingNode>&)> visit
+      = [&](const std::shared_ptr<PatternRoutingNode>& node) {
+          if (visited[node->getIndex()]) {
+            return;
+          }
+          visited[node->getIndex()] = true;
+          box.update(*node);
+          for (auto& child_paths : node->getPaths()) {
+            for (auto& path : child_paths) {
+              visit(path);
+            }
+          }
+        };
+  visit(routing_dag_);
+  return box;
+}
+
 void PatternRoute::run()
 {
   calculateRoutingCosts(routing_dag_);
@@ -167,6 +167,10 @@ class PatternRoute
     return routing_dag_;
   }
 
+  // Bounding box of every node of the routing DAG, i.e. of every gcell
+  // that run() may read costs from.
+  BoxT getRoutingDAGBox() const;
+
  private:
   void constructPaths(std::shared_ptr<PatternRoutingNode>& start,
                       std::shared_ptr<PatternRoutingNode>& end,
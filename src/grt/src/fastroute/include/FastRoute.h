@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstdint>
+#include <iosfwd>
 #include <limits>
 #include <memory>
 #include <set>
@@ -167,6 +168,11 @@ class FastRouteCore
                               bool is_horizontal,
                               int& adjustment);
   void initBlockedIntervals(std::vector<int>& track_space);
+  // Raw dump of the edge capacities left by setup and adjustments, used by
+  // the global routing checkpoint. readCapacities expects initEdges() on the
+  // same grid and returns false when the data doesn't fit it.
+  void writeCapacities(std::ostream& out) const;
+  bool readCapacities(std::istream& in);
   void initAuxVar();
   NetRouteMap run();
   int totalOverflow() const { return total_overflow_; }
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <iosfwd>
 #include <set>
 #include <string>
 #include <utility>
@@ -95,6 +96,9 @@ class Graph2D
                                int& max_adj);
   void str_accu(int rnd);
   void saveResources(int x, int y, bool is_horizontal);
+  // Raw dump of the capacity, reduction and real capacity of every edge.
+  void writeResources(std::ostream& out) const;
+  bool readResources(std::istream& in);
   bool computeSuggestedAdjustment(int x,
                                   int y,
                                   bool is_horizontal,
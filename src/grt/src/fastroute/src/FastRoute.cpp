@@ -8,9 +8,11 @@
 #include <cmath>
 #include <cstdint>
 #include <fstream>
+#include <istream>
 #include <limits>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <tuple>
 #include <unordered_set>
@@ -886,6 +888,60 @@ void FastRouteCore::initBlockedIntervals(std::vector<int>& track_space)
   }
 }
 
+void FastRouteCore::writeCapacities(std::ostream& out) const
+{
+  const int32_t dims[] = {x_grid_, y_grid_, num_layers_};
+  out.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+  out.write(reinterpret_cast<const char*>(h_capacity_3D_.data()),
+            sizeof(int16_t) * num_layers_);
+  out.write(reinterpret_cast<const char*>(v_capacity_3D_.data()),
+            sizeof(int16_t) * num_layers_);
+  for (const multi_array<Edge3D, 3>* edges : {&h_edges_3D_, &v_edges_3D_}) {
+    const Edge3D* end = edges->data() + edges->num_elements();
+    for (const Edge3D* edge = edges->data(); edge != end; edge++) {
+      const uint16_t values[] = {edge->cap, edge->red, edge->real_cap};
+      out.write(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+  }
+  graph2d_.writeResources(out);
+}
+
+bool FastRouteCore::readCapacities(std::istream& in)
+{
+  int32_t dims[3];
+  if (!in.read(reinterpret_cast<char*>(dims), sizeof(dims))
+      || dims[0] != x_grid_ || dims[1] != y_grid_ || dims[2] != num_layers_) {
+    return false;
+  }
+  std::vector<int16_t> h_caps(num_layers_);
+  std::vector<int16_t> v_caps(num_layers_);
+  if (!in.read(reinterpret_cast<char*>(h_caps.data()),
+               sizeof(int16_t) * num_layers_)
+      || !in.read(reinterpret_cast<char*>(v_caps.data()),
+                  sizeof(int16_t) * num_layers_)) {
+    return false;
+  }
+  h_capacity_ = 0;
+  v_capacity_ = 0;
+  for (int layer = 1; layer <= num_layers_; layer++) {
+    addHCapacity(h_caps[layer - 1], layer);
+    addVCapacity(v_caps[layer - 1], layer);
+  }
+  for (multi_array<Edge3D, 3>* edges : {&h_edges_3D_, &v_edges_3D_}) {
+    Edge3D* end = edges->data() + edges->num_elements();
+    for (Edge3D* edge = edges->data(); edge != end; edge++) {
+      uint16_t values[3];
+      if (!in.read(reinterpret_cast<char*>(values), sizeof(values))) {
+        return false;
+      }
+      edge->cap = values[0];
+      edge->red = values[1];
+      edge->real_cap = values[2];
+    }
+  }
+  return graph2d_.readResources(in);
+}
+
 int FastRouteCore::getAvailableResources(int x1,
                                          int y1,
                                          int x2,
@@ -8,6 +8,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <istream>
+#include <ostream>
 #include <set>
 #include <string>
 #include <utility>
@@ -514,6 +516,34 @@ void Graph2D::saveResources(const int x, const int y, bool is_horizontal)
   }
 }
 
+void Graph2D::writeResources(std::ostream& out) const
+{
+  for (const multi_array<Edge, 2>* edges : {&h_edges_, &v_edges_}) {
+    const Edge* end = edges->data() + edges->num_elements();
+    for (const Edge* edge = edges->data(); edge != end; edge++) {
+      const uint16_t values[] = {edge->cap, edge->red, edge->real_cap};
+      out.write(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+  }
+}
+
+bool Graph2D::readResources(std::istream& in)
+{
+  for (multi_array<Edge, 2>* edges : {&h_edges_, &v_edges_}) {
+    Edge* end = edges->data() + edges->num_elements();
+    for (Edge* edge = edges->data(); edge != end; edge++) {
+      uint16_t values[3];
+      if (!in.read(reinterpret_cast<char*>(values), sizeof(values))) {
+        return false;
+      }
+      edge->cap = values[0];
+      edge->red = values[1];
+      edge->real_cap = values[2];
+    }
+  }
+  return true;
+}
+
 bool Graph2D::computeSuggestedAdjustment(const int x,
                                          const int y,
                                          bool is_horizontal,
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "grt/GlobalRouter.h"
+#include "grt/Rudy.h"
+#include "gtest/gtest.h"
+#include "odb/PtrSetMap.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/geom.h"
+#include "tst/IntegratedFixture.h"
+
+namespace grt {
+
+class RudyTest : public tst::IntegratedFixture
+{
+ protected:
+  RudyTest()
+      : tst::IntegratedFixture(tst::IntegratedFixture::Technology::kNangate45,
+                               "_main/src/grt/test/")
+  {
+    odb::dbChip* chip = odb::dbChip::create(db_.get(), db_->getTech());
+    odb::defin reader(db_.get(), &logger_);
+    std::vector<odb::dbLib*> libs{lib_};
+    const std::string path = getFilePath(test_root_path_ + "gcd.def");
+    reader.readChip(libs, path.c_str(), chip);
+    block_ = chip->getBlock();
+    sta_->postReadDef(block_);
+  }
+
+  // Expects every tile of rudy to match a full calculation on the current
+  // placement.
+  void expectMatchesFullCalculation(const Rudy& rudy, const int pass)
+  {
+    Rudy full(block_, &grt_);
+    full.calculateRudy();
+    const auto [x_size, y_size] = full.getGridSize();
+    ASSERT_EQ(rudy.getGridSize(), full.getGridSize());
+    for (int x = 0; x < x_size; x++) {
+      for (int y = 0; y < y_size; y++) {
+        const float expected = full.getTile(x, y).getRudy();
+        EXPECT_NEAR(rudy.getTile(x, y).getRudy(),
+                    expected,
+                    1e-4 * std::max(1.0f, std::abs(expected)))
+            << "pass " << pass << " tile " << x << ", " << y;
+      }
+    }
+  }
+};
+
+// Moves a few instances per pass, as placement iterations do, and updates
+// only their nets. The result must stay within rounding of a full
+// calculation, including across the periodic full recalculations.
+TEST_F(RudyTest, IncrementalUpdateMatchesFullCalculation)
+{
+  ASSERT_NE(block_, nullptr);
+  std::vector<odb::dbInst*> insts;
+  for (odb::dbInst* inst : block_->getInsts()) {
+    if (inst->getMaster()->isCore() && !inst->isFixed()) {
+      insts.push_back(inst);
+    }
+  }
+  ASSERT_GE(insts.size(), 100);
+
+  Rudy rudy(block_, &grt_);
+  rudy.calculateRudy();
+  expectMatchesFullCalculation(rudy, 0);
+
+  const odb::Rect die = block_->getDieArea();
+  const int max_step = 3 * rudy.getTileSize();
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> pick(0, insts.size() - 1);
+  std::uniform_int_distribution<int> step(-max_step, max_step);
+  for (int pass = 1; pass <= 40; pass++) {
+    odb::PtrSet<odb::dbNet> nets;
+    for (int i = 0; i < 20; i++) {
+      odb::dbInst* inst = insts[pick(rng)];
+      const odb::Rect bbox = inst->getBBox()->getBox();
+      const int x = std::clamp(
+          bbox.xMin() + step(rng), die.xMin(), die.xMax() - bbox.dx());
+      const int y = std::clamp(
+          bbox.yMin() + step(rng), die.yMin(), die.yMax() - bbox.dy());
+      inst->setLocation(x, y);
+      for (odb::dbITerm* iterm : inst->getITerms()) {
+        if (iterm->getNet() != nullptr) {
+          nets.insert(iterm->getNet());
+        }
+      }
+    }
+    rudy.updateRudy(nets);
+    expectMatchesFullCalculation(rudy, pass);
+  }
+}
+
+}  // namespace grt
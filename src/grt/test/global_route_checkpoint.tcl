@@ -0,0 +1,76 @@
+# global routing checkpoint round trip. def file generated using the openroad-flow
+source "helpers.tcl"
+read_liberty "sky130hs/sky130hs_tt.lib"
+read_lef "sky130hs/sky130hs.tlef"
+read_lef "sky130hs/sky130hs_std_cell.lef"
+read_def "gcd_sky130.def"
+
+set_placement_padding -global -left 2 -right 2
+set_global_routing_layer_adjustment met2-met5 0.15
+set_routing_layers -signal met1-met5
+global_route
+
+set checkpoint_file [make_result_file global_route_checkpoint.grt]
+write_global_route_checkpoint $checkpoint_file
+
+set guide_file1 [make_result_file global_route_checkpoint1.guide]
+write_guides $guide_file1
+
+# A checkpoint taken with other settings is ignored and the routing is kept.
+set_global_routing_layer_adjustment met2-met5 0.2
+check "mismatched checkpoint is ignored" {
+  tee -quiet -variable report \
+    [list read_global_route_checkpoint $checkpoint_file]
+} 0
+check "mismatched checkpoint is reported" {
+  string match "*GRT-0317*" $report
+} 1
+set guide_file2 [make_result_file global_route_checkpoint2.guide]
+write_guides $guide_file2
+check "routing is kept after a mismatched checkpoint" {
+  diff_files $guide_file1 $guide_file2
+} 0
+
+set_global_routing_layer_adjustment met2-met5 0.15
+
+# A checkpoint cut short in its nets is rejected and the routing is kept.
+set stream [open $checkpoint_file rb]
+set checkpoint_data [read $stream]
+close $stream
+set truncated_file [make_result_file global_route_checkpoint_truncated.grt]
+set stream [open $truncated_file wb]
+puts -nonewline $stream [string range $checkpoint_data 0 end-10]
+close $stream
+check "truncated checkpoint is rejected" {
+  catch { read_global_route_checkpoint $truncated_file } error
+} 1
+check "truncated checkpoint is reported" {
+  string match "*GRT-0315*" $error
+} 1
+set guide_file_truncated \
+  [make_result_file global_route_checkpoint_truncated.guide]
+write_guides $guide_file_truncated
+check "routing is kept after a truncated checkpoint" {
+  diff_files $guide_file1 $guide_file_truncated
+} 0
+
+check "checkpoint is restored" {
+  tee -quiet -variable report \
+    [list read_global_route_checkpoint $checkpoint_file]
+} 1
+set guide_file3 [make_result_file global_route_checkpoint3.guide]
+write_guides $guide_file3
+check "restored routing matches global_route" {
+  diff_files $guide_file1 $guide_file3
+} 0
+
+# The restored routing and resources are enough for repair_antennas, and it
+# gives the same result as right after global_route (see repair_antennas1).
+repair_antennas
+set guide_file4 [make_result_file global_route_checkpoint4.guide]
+write_guides $guide_file4
+check "repair_antennas after restore" {
+  diff_files repair_antennas1.guideok $guide_file4
+} 0
+
+exit_summary
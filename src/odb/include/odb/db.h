@@ -7679,15 +7679,23 @@ class dbDatabase : public dbObject
   ///
   /// Read a database from this stream.
   /// WARNING: This function destroys the data currently in the database.
+  /// Independent table sections are deserialized using up to threads threads.
+  /// skip_wires and skip_parasitics leave the routed wires and the parasitic
+  /// tables empty, which makes loading faster for netlist or placement only
+  /// sessions.
   /// Throws ZIOError..
   ///
-  void read(std::istream& f);
+  void read(std::istream& f,
+            int threads = 1,
+            bool skip_wires = false,
+            bool skip_parasitics = false);
 
   ///
   /// Write a database to this stream.
+  /// Independent table sections are serialized using up to threads threads.
   /// Throws ZIOError..
   ///
-  void write(std::ostream& file);
+  void write(std::ostream& file, int threads = 1);
 
   ///
   /// ECO - The following methods implement a simple ECO mechanism for capturing
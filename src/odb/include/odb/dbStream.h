@@ -6,6 +6,7 @@
 #include <string.h>  // NOLINT(modernize-deprecated-headers): for strdup()
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -34,6 +35,8 @@ class dbOStream
   using Position = std::ostream::pos_type;
 
   dbOStream(_dbDatabase* db, std::ostream& f);
+  // A stream for one section of parent's file, sharing its units.
+  dbOStream(const dbOStream& parent, std::ostream& f);
 
   _dbDatabase* getDatabase() { return db_; }
 
@@ -236,6 +239,17 @@ class dbOStream
 
   Position pos() const { return f_.tellp(); }
 
+  // The current position, or -1 if the file can't seek (eg it is written
+  // through a compressor).
+  Position seekablePos() const;
+  void seek(Position pos) { f_.seekp(pos); }
+
+  void writeBytes(const char* data, size_t size) { f_.write(data, size); }
+
+  // Number of threads available for writing independent sections
+  void setThreads(int threads) { threads_ = threads; }
+  int getThreads() const { return threads_; }
+
   void pushScope(const std::string& name);
   void popScope();
 
@@ -260,6 +274,7 @@ class dbOStream
   double lef_area_factor_;
   double lef_dist_factor_;
   std::vector<Scope> scopes_;
+  int threads_ = 1;
 };
 
 // RAII class for scoping ostream operations
@@ -281,6 +296,8 @@ class dbIStream
 {
  public:
   dbIStream(_dbDatabase* db, std::istream& f);
+  // A stream for one section of parent's file, sharing its units and options.
+  dbIStream(const dbIStream& parent, std::istream& f);
 
   _dbDatabase* getDatabase() { return db_; }
 
@@ -495,6 +512,19 @@ class dbIStream
 
   double lefdist(int value) { return ((double) value * lef_dist_factor_); }
 
+  void readBytes(char* data, size_t size) { f_.read(data, size); }
+  void skipBytes(size_t size) { f_.ignore(size); }
+
+  // Number of threads available for reading independent sections
+  void setThreads(int threads) { threads_ = threads; }
+  int getThreads() const { return threads_; }
+
+  // Skip loading of routed wires and/or parasitics
+  void setSkipWires(bool skip) { skip_wires_ = skip; }
+  bool skipWires() const { return skip_wires_; }
+  void setSkipParasitics(bool skip) { skip_parasitics_ = skip; }
+  bool skipParasitics() const { return skip_parasitics_; }
+
  private:
   template <uint32_t I = 0, typename... Ts>
   dbIStream& variantHelper(uint32_t index, std::variant<Ts...>& v)
@@ -518,6 +548,9 @@ class dbIStream
   _dbDatabase* db_;
   double lef_area_factor_;
   double lef_dist_factor_;
+  int threads_ = 1;
+  bool skip_wires_ = false;
+  bool skip_parasitics_ = false;
 };
 
 }  // namespace odb
@@ -41,6 +41,10 @@ class defin
   void skipFillWires();
   void continueOnErrors();
   void useBlockName(const char* name);
+  // Parse the NETS section of large DEF files with up to threads threads
+  void setThreads(int threads);
+  // Smallest number of nets in a parallel chunk (tests lower it)
+  void setMinNetsPerChunk(int nets);
 
   /// Create a new chip
   void readChip(std::vector<dbLib*>& search_libs,
@@ -36,6 +36,12 @@ class DefOut
 
   void setVersion(Version v);  // default is 5.8
 
+  // Number of threads used to format COMPONENTS, SPECIALNETS and NETS.
+  // The output is identical for any thread count.
+  void setThreads(int threads);  // default is 1
+  // Smallest number of items per parallel task (tests lower it)
+  void setMinItemsPerChunk(int items);  // default is 1000
+
   bool writeBlock(dbBlock* block, const char* def_file);
 
  private:
@@ -21,10 +21,12 @@
 #include <iterator>
 #include <list>
 #include <map>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <set>
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -132,6 +134,7 @@
 #include "odb/isotropy.h"
 #include "odb/poly_decomp.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace odb {
 
@@ -733,6 +736,142 @@ dbIStream& operator>>(dbIStream& stream, _dbBTermTopLayerGrid& obj)
   return stream;
 }
 
+// Upper bound on the bytes of buffered sections read concurrently.  A single
+// section larger than this is still read, on its own.
+static constexpr uint64_t kSectionBatchBytes = uint64_t(256) << 20;
+
+// Serializes one section into memory.
+static std::string serializeSection(
+    const dbOStream& stream,
+    const std::function<void(dbOStream&)>& writer)
+{
+  std::ostringstream buffer;
+  buffer.exceptions(std::ios::failbit | std::ios::badbit);
+  dbOStream section(stream, buffer);
+  writer(section);
+  return std::move(buffer).str();
+}
+
+static void writeSection(dbOStream& stream, const std::string& section)
+{
+  stream << (uint64_t) section.size();
+  stream.writeBytes(section.data(), section.size());
+}
+
+// Writes each table as an independent section preceded by its size.  With
+// more than one thread batches of sections are serialized concurrently into
+// memory.  With a single thread a section is written in place and its size
+// is patched afterwards; if the file can't seek, only that one section is
+// buffered.
+static void writeTableSections(
+    dbOStream& stream,
+    const std::vector<std::function<void(dbOStream&)>>& writers)
+{
+  stream << (uint32_t) writers.size();
+
+  const size_t threads = std::max(stream.getThreads(), 1);
+  if (threads == 1) {
+    for (const auto& writer : writers) {
+      const dbOStream::Position size_pos = stream.seekablePos();
+      if (size_pos == dbOStream::Position(-1)) {
+        writeSection(stream, serializeSection(stream, writer));
+        continue;
+      }
+      stream << (uint64_t) 0;
+      writer(stream);
+      const dbOStream::Position end_pos = stream.seekablePos();
+      stream.seek(size_pos);
+      stream << (uint64_t) (end_pos - size_pos - sizeof(uint64_t));
+      stream.seek(end_pos);
+    }
+    return;
+  }
+
+  utl::ThreadPool thread_pool(threads);
+  for (size_t begin = 0; begin < writers.size(); begin += threads) {
+    std::vector<size_t> indices(std::min(threads, writers.size() - begin));
+    std::iota(indices.begin(), indices.end(), begin);
+    const std::vector<std::string> sections
+        = thread_pool.parallelMap(indices, [&](const size_t index) {
+            return serializeSection(stream, writers[index]);
+          });
+    for (const std::string& section : sections) {
+      writeSection(stream, section);
+    }
+  }
+}
+
+// Reads the sections written by writeTableSections.  Sections with an empty
+// reader are skipped.  With a single thread the sections are read in place;
+// otherwise they are buffered in batches bounded by the thread count and
+// kSectionBatchBytes, and each batch is deserialized concurrently.
+static void readTableSections(
+    dbIStream& stream,
+    const std::vector<std::function<void(dbIStream&)>>& readers)
+{
+  _dbDatabase* db = stream.getDatabase();
+  uint32_t count;
+  stream >> count;
+  if (count != readers.size()) {
+    db->getLogger()->error(utl::ODB,
+                           1219,
+                           "Block table section count mismatch {} vs {}",
+                           count,
+                           readers.size());
+  }
+
+  const size_t threads = std::max(stream.getThreads(), 1);
+  if (threads == 1) {
+    for (uint32_t i = 0; i < count; ++i) {
+      uint64_t size;
+      stream >> size;
+      if (readers[i]) {
+        readers[i](stream);
+      } else {
+        stream.skipBytes(size);
+      }
+    }
+    return;
+  }
+
+  utl::ThreadPool thread_pool(threads);
+  std::vector<size_t> batch;
+  std::vector<std::string> sections(count);
+  uint64_t batch_bytes = 0;
+  auto read_batch = [&]() {
+    thread_pool.parallelFor(batch, [&](const size_t index) {
+      std::istringstream buffer(std::move(sections[index]));
+      buffer.exceptions(std::ios::failbit | std::ios::badbit
+                        | std::ios::eofbit);
+      dbIStream section(stream, buffer);
+      readers[index](section);
+    });
+    batch.clear();
+    batch_bytes = 0;
+  };
+
+  for (uint32_t i = 0; i < count; ++i) {
+    uint64_t size;
+    stream >> size;
+    if (!readers[i]) {
+      stream.skipBytes(size);
+      continue;
+    }
+    if (!batch.empty()
+        && (batch.size() == threads
+            || batch_bytes + size > kSectionBatchBytes)) {
+      read_batch();
+    }
+    sections[i].resize(size);
+    stream.readBytes(sections[i].data(), size);
+    batch.push_back(i);
+    batch_bytes += size;
+  }
+  if (!batch.empty()) {
+    read_batch();
+  }
+}
+
 dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
 {
   std::list<dbBlockCallBackObj*>::const_iterator cbitr;
@@ -804,15 +943,17 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block.global_connect_tbl_;
   stream << *block.guide_tbl_;
   stream << *block.net_tracks_tbl_;
-  stream << *block.box_tbl_;
-  stream << *block.via_tbl_;
-  stream << *block.gcell_grid_tbl_;
-  stream << *block.track_grid_tbl_;
-  stream << *block.obstruction_tbl_;
-  stream << *block.blockage_tbl_;
-  stream << *block.wire_tbl_;
-  stream << *block.swire_tbl_;
-  stream << *block.sbox_tbl_;
+  writeTableSections(
+      stream,
+      {[&](dbOStream& section) { section << *block.box_tbl_; },
+       [&](dbOStream& section) { section << *block.via_tbl_; },
+       [&](dbOStream& section) { section << *block.gcell_grid_tbl_; },
+       [&](dbOStream& section) { section << *block.track_grid_tbl_; },
+       [&](dbOStream& section) { section << *block.obstruction_tbl_; },
+       [&](dbOStream& section) { section << *block.blockage_tbl_; },
+       [&](dbOStream& section) { section << *block.wire_tbl_; },
+       [&](dbOStream& section) { section << *block.swire_tbl_; },
+       [&](dbOStream& section) { section << *block.sbox_tbl_; }});
   stream << *block.row_tbl_;
   stream << *block.fill_tbl_;
   stream << *block.region_tbl_;
@@ -823,12 +964,20 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block.prop_tbl_;
 
   stream << *block.name_cache_;
-  stream << *block.r_val_tbl_;
-  stream << *block.c_val_tbl_;
-  stream << *block.cc_val_tbl_;
-  stream << NamedTable("cap_node_tbl", block.cap_node_tbl_);
-  stream << NamedTable("r_seg_tbl", block.r_seg_tbl_);
-  stream << NamedTable("cc_seg_tbl", block.cc_seg_tbl_);
+  writeTableSections(
+      stream,
+      {[&](dbOStream& section) { section << *block.r_val_tbl_; },
+       [&](dbOStream& section) { section << *block.c_val_tbl_; },
+       [&](dbOStream& section) { section << *block.cc_val_tbl_; },
+       [&](dbOStream& section) {
+         section << NamedTable("cap_node_tbl", block.cap_node_tbl_);
+       },
+       [&](dbOStream& section) {
+         section << NamedTable("r_seg_tbl", block.r_seg_tbl_);
+       },
+       [&](dbOStream& section) {
+         section << NamedTable("cc_seg_tbl", block.cc_seg_tbl_);
+       }});
   stream << *block.ext_control_;
   stream << block.dft_;
   stream << *block.dft_tbl_;
@@ -1041,15 +1190,33 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   if (db->isSchema(kSchemaNetTracks)) {
     stream >> *block.net_tracks_tbl_;
   }
-  stream >> *block.box_tbl_;
-  stream >> *block.via_tbl_;
-  stream >> *block.gcell_grid_tbl_;
-  stream >> *block.track_grid_tbl_;
-  stream >> *block.obstruction_tbl_;
-  stream >> *block.blockage_tbl_;
-  stream >> *block.wire_tbl_;
-  stream >> *block.swire_tbl_;
-  stream >> *block.sbox_tbl_;
+  if (db->isSchema(kSchemaBlockTableSections)) {
+    std::function<void(dbIStream&)> read_wires;
+    if (!stream.skipWires()) {
+      read_wires = [&](dbIStream& section) { section >> *block.wire_tbl_; };
+    }
+    readTableSections(
+        stream,
+        {[&](dbIStream& section) { section >> *block.box_tbl_; },
+         [&](dbIStream& section) { section >> *block.via_tbl_; },
+         [&](dbIStream& section) { section >> *block.gcell_grid_tbl_; },
+         [&](dbIStream& section) { section >> *block.track_grid_tbl_; },
+         [&](dbIStream& section) { section >> *block.obstruction_tbl_; },
+         [&](dbIStream& section) { section >> *block.blockage_tbl_; },
+         read_wires,
+         [&](dbIStream& section) { section >> *block.swire_tbl_; },
+         [&](dbIStream& section) { section >> *block.sbox_tbl_; }});
+  } else {
+    stream >> *block.box_tbl_;
+    stream >> *block.via_tbl_;
+    stream >> *block.gcell_grid_tbl_;
+    stream >> *block.track_grid_tbl_;
+    stream >> *block.obstruction_tbl_;
+    stream >> *block.blockage_tbl_;
+    stream >> *block.wire_tbl_;
+    stream >> *block.swire_tbl_;
+    stream >> *block.sbox_tbl_;
+  }
   stream >> *block.row_tbl_;
   stream >> *block.fill_tbl_;
   stream >> *block.region_tbl_;
@@ -1059,12 +1226,25 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block.layer_rule_tbl_;
   stream >> *block.prop_tbl_;
   stream >> *block.name_cache_;
-  stream >> *block.r_val_tbl_;
-  stream >> *block.c_val_tbl_;
-  stream >> *block.cc_val_tbl_;
-  stream >> *block.cap_node_tbl_;  // DKF
-  stream >> *block.r_seg_tbl_;     // DKF
-  stream >> *block.cc_seg_tbl_;
+  if (db->isSchema(kSchemaBlockParasiticSections)) {
+    std::vector<std::function<void(dbIStream&)>> readers(6);
+    if (!stream.skipParasitics()) {
+      readers = {[&](dbIStream& section) { section >> *block.r_val_tbl_; },
+                 [&](dbIStream& section) { section >> *block.c_val_tbl_; },
+                 [&](dbIStream& section) { section >> *block.cc_val_tbl_; },
+                 [&](dbIStream& section) { section >> *block.cap_node_tbl_; },
+                 [&](dbIStream& section) { section >> *block.r_seg_tbl_; },
+                 [&](dbIStream& section) { section >> *block.cc_seg_tbl_; }};
+    }
+    readTableSections(stream, readers);
+  } else {
+    stream >> *block.r_val_tbl_;
+    stream >> *block.c_val_tbl_;
+    stream >> *block.cc_val_tbl_;
+    stream >> *block.cap_node_tbl_;  // DKF
+    stream >> *block.r_seg_tbl_;     // DKF
+    stream >> *block.cc_seg_tbl_;
+  }
   stream >> *block.ext_control_;
   if (db->isSchema(kSchemaAddScan)) {
     stream >> block.dft_;
@@ -1130,6 +1310,29 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
     ((_dbITerm*) iterm)->resolveMTerm();
   }
 
+  // Drop net references into tables that were skipped on read
+  const bool skipped_wires
+      = stream.skipWires() && db->isSchema(kSchemaBlockTableSections);
+  const bool skipped_parasitics
+      = stream.skipParasitics() && db->isSchema(kSchemaBlockParasiticSections);
+  if (skipped_wires || skipped_parasitics) {
+    dbSet<dbNet> nets((dbBlock*) &block, block.net_tbl_);
+    for (dbNet* net : nets) {
+      _dbNet* n = (_dbNet*) net;
+      if (skipped_wires) {
+        n->wire_ = 0;
+        n->global_wire_ = 0;
+        n->flags_.wire_ordered = 0;
+      }
+      if (skipped_parasitics) {
+        n->cap_nodes_ = 0;
+        n->r_segs_ = 0;
+        n->flags_.extracted = 0;
+        n->flags_.rc_graph = 0;
+      }
+    }
+  }
+
   return stream;
 }
 
@@ -923,18 +923,25 @@ bool dbDatabase::hasHierarchy() const
   return db->hierarchy_;
 }
 
-void dbDatabase::read(std::istream& file)
+void dbDatabase::read(std::istream& file,
+                      int threads,
+                      bool skip_wires,
+                      bool skip_parasitics)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbIStream stream(db, file);
+  stream.setThreads(threads);
+  stream.setSkipWires(skip_wires);
+  stream.setSkipParasitics(skip_parasitics);
   stream >> *db;
   ((dbDatabase*) db)->triggerPostReadDb();
 }
 
-void dbDatabase::write(std::ostream& file)
+void dbDatabase::write(std::ostream& file, int threads)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
+  stream.setThreads(threads);
   stream << *db;
   file.flush();
 }
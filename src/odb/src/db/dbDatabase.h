@@ -50,7 +50,15 @@ namespace odb {
 inline constexpr uint32_t kSchemaMajor = 0;  // Not used...
 inline constexpr uint32_t kSchemaInitial = 57;
 
-inline constexpr uint32_t kSchemaMinor = 134;  // Current revision number
+inline constexpr uint32_t kSchemaMinor = 136;  // Current revision number
+
+// Revision where the block parasitic tables are stored as length-prefixed
+// sections so that they can be skipped on read
+inline constexpr uint32_t kSchemaBlockParasiticSections = 136;
+
+// Revision where the block geometry tables are stored as length-prefixed
+// sections that can be read and written concurrently
+inline constexpr uint32_t kSchemaBlockTableSections = 135;
 
 // Revision where the per-corner child-block feature for parasitics was removed
 inline constexpr uint32_t kSchemaRemovePerCornerBlock = 134;
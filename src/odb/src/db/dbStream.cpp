@@ -4,6 +4,8 @@
 #include "odb/dbStream.h"
 
 #include <algorithm>
+#include <exception>
+#include <ios>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -172,6 +174,25 @@ dbOStream::dbOStream(_dbDatabase* db, std::ostream& f) : f_(f)
   }
 }
 
+dbOStream::dbOStream(const dbOStream& parent, std::ostream& f)
+    : db_(parent.db_),
+      f_(f),
+      lef_area_factor_(parent.lef_area_factor_),
+      lef_dist_factor_(parent.lef_dist_factor_)
+{
+}
+
+dbOStream::Position dbOStream::seekablePos() const
+{
+  // Ask the buffer directly: a failed seek through the stream would set its
+  // badbit, while some buffers (eg boost's gzip filter) throw.
+  try {
+    return f_.rdbuf()->pubseekoff(0, std::ios::cur, std::ios::out);
+  } catch (const std::exception&) {
+    return Position(-1);
+  }
+}
+
 dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : f_(f)
 {
   db_ = db;
@@ -187,6 +208,16 @@ dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : f_(f)
   }
 }
 
+dbIStream::dbIStream(const dbIStream& parent, std::istream& f)
+    : f_(f),
+      db_(parent.db_),
+      lef_area_factor_(parent.lef_area_factor_),
+      lef_dist_factor_(parent.lef_dist_factor_),
+      skip_wires_(parent.skip_wires_),
+      skip_parasitics_(parent.skip_parasitics_)
+{
+}
+
 std::ostream& operator<<(std::ostream& os, const Rect& box)
 {
   os << "( " << box.xMin() << " " << box.yMin() << " ) ( " << box.xMax() << " "
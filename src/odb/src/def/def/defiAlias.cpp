@@ -37,7 +37,7 @@
 
 BEGIN_DEF_PARSER_NAMESPACE
 
-extern defrContext defContext;
+extern thread_local defrContext defContext;
 
 class defAliasIterator
 {
@@ -397,6 +397,8 @@ defrContext::defrContext(int ownConf) : ownConfig(ownConf)
 {
 }
 
-defrContext defContext;
+// OpenROAD: thread local so that each thread runs its own parser session
+// (see ../README.md).
+thread_local defrContext defContext;
 
 END_DEF_PARSER_NAMESPACE
@@ -61,7 +61,7 @@ BEGIN_DEF_PARSER_NAMESPACE
 
 extern int defyyparse(defrData* data);
 
-extern defrContext defContext;
+extern thread_local defrContext defContext;
 
 void def_init(const char* func)
 {
@@ -66,6 +66,16 @@ void defin::useBlockName(const char* name)
   reader_->useBlockName(name);
 }
 
+void defin::setThreads(int threads)
+{
+  reader_->setThreads(threads);
+}
+
+void defin::setMinNetsPerChunk(int nets)
+{
+  reader_->setMinNetsPerChunk(nets);
+}
+
 void defin::readChip(std::vector<dbLib*>& libs,
                      const char* def_file,
                      dbChip* chip,
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "definNetRecorder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "definNet.h"
+#include "odb/dbTypes.h"
+
+namespace odb {
+
+definNetRecorder::definNetRecorder(utl::Logger* logger,
+                                   const bool continue_on_errors,
+                                   const int64_t first_line)
+    : logger_(logger),
+      continue_on_errors_(continue_on_errors),
+      first_line_(first_line)
+{
+}
+
+void definNetRecorder::record(Op op, int a, int b, int c, int d)
+{
+  calls_.push_back({op, {a, b, c, d}});
+}
+
+void definNetRecorder::addString(const char* str)
+{
+  strings_.append(str, std::strlen(str) + 1);
+}
+
+void definNetRecorder::begin(const char* name)
+{
+  addString(name);
+  record(Op::kBegin);
+}
+
+void definNetRecorder::beginMustjoin(const char* iname, const char* pname)
+{
+  addString(iname);
+  addString(pname);
+  record(Op::kBeginMustjoin);
+}
+
+void definNetRecorder::connection(const char* iname, const char* pname)
+{
+  addString(iname);
+  addString(pname);
+  record(Op::kConnection);
+}
+
+void definNetRecorder::nonDefaultRule(const char* rule)
+{
+  addString(rule);
+  record(Op::kNonDefaultRule);
+}
+
+void definNetRecorder::use(dbSigType type)
+{
+  record(Op::kUse, type.getValue());
+}
+
+void definNetRecorder::wire(dbWireType type)
+{
+  record(Op::kWire, type.getValue());
+}
+
+void definNetRecorder::path(const char* layer)
+{
+  addString(layer);
+  record(Op::kPath);
+}
+
+void definNetRecorder::pathTaper(const char* layer)
+{
+  addString(layer);
+  record(Op::kPathTaper);
+}
+
+void definNetRecorder::pathTaperRule(const char* layer, const char* rule)
+{
+  addString(layer);
+  addString(rule);
+  record(Op::kPathTaperRule);
+}
+
+void definNetRecorder::pathPoint(int x, int y)
+{
+  record(Op::kPathPoint, x, y);
+}
+
+void definNetRecorder::pathPoint(int x, int y, int ext)
+{
+  record(Op::kPathPointExt, x, y, ext);
+}
+
+void definNetRecorder::pathVirtualPoint(int x, int y)
+{
+  record(Op::kPathVirtualPoint, x, y);
+}
+
+void definNetRecorder::pathVia(const char* via)
+{
+  addString(via);
+  record(Op::kPathVia);
+}
+
+void definNetRecorder::pathVia(const char* via, dbOrientType orient)
+{
+  addString(via);
+  record(Op::kPathViaRotated, orient.getValue());
+}
+
+void definNetRecorder::pathRect(int deltaX1,
+                                int deltaY1,
+                                int deltaX2,
+                                int deltaY2)
+{
+  record(Op::kPathRect, deltaX1, deltaY1, deltaX2, deltaY2);
+}
+
+void definNetRecorder::pathColor(int color)
+{
+  record(Op::kPathColor, color);
+}
+
+void definNetRecorder::pathViaColor(int bottom_color,
+                                    int cut_color,
+                                    int top_color)
+{
+  record(Op::kPathViaColor, bottom_color, cut_color, top_color);
+}
+
+void definNetRecorder::pathEnd()
+{
+  record(Op::kPathEnd);
+}
+
+void definNetRecorder::wireEnd()
+{
+  record(Op::kWireEnd);
+}
+
+void definNetRecorder::source(dbSourceType source)
+{
+  record(Op::kSource, source.getValue());
+}
+
+void definNetRecorder::weight(int weight)
+{
+  record(Op::kWeight, weight);
+}
+
+void definNetRecorder::fixedbump()
+{
+  record(Op::kFixedbump);
+}
+
+void definNetRecorder::property(const char* name, const char* value)
+{
+  addString(name);
+  addString(value);
+  record(Op::kPropertyString);
+}
+
+void definNetRecorder::property(const char* name, int value)
+{
+  addString(name);
+  record(Op::kPropertyInt, value);
+}
+
+void definNetRecorder::property(const char* name, double value)
+{
+  addString(name);
+  doubles_.push_back(value);
+  record(Op::kPropertyDouble);
+}
+
+void definNetRecorder::end()
+{
+  record(Op::kEnd);
+}
+
+bool definNetRecorder::error(const char* msg)
+{
+  addString(msg);
+  record(Op::kError);
+  return continue_on_errors_;
+}
+
+bool definNetRecorder::replay(
+    definNet* net_reader,
+    const std::function<bool(const char*)>& report_error) const
+{
+  // Strings and doubles are stored in call order
+  size_t string_offset = 0;
+  size_t double_index = 0;
+  auto next_string = [&]() {
+    const char* str = strings_.data() + string_offset;
+    string_offset += std::strlen(str) + 1;
+    return str;
+  };
+
+  for (const Call& call : calls_) {
+    const int* args = call.args;
+    switch (call.op) {
+      case Op::kBegin:
+        net_reader->begin(next_string());
+        break;
+      case Op::kBeginMustjoin: {
+        const char* iname = next_string();
+        const char* pname = next_string();
+        net_reader->beginMustjoin(iname, pname);
+        break;
+      }
+      case Op::kConnection: {
+        const char* iname = next_string();
+        const char* pname = next_string();
+        net_reader->connection(iname, pname);
+        break;
+      }
+      case Op::kNonDefaultRule:
+        net_reader->nonDefaultRule(next_string());
+        break;
+      case Op::kUse:
+        net_reader->use(dbSigType((dbSigType::Value) args[0]));
+        break;
+      case Op::kWire:
+        net_reader->wire(dbWireType((dbWireType::Value) args[0]));
+        break;
+      case Op::kPath:
+        net_reader->path(next_string());
+        break;
+      case Op::kPathTaper:
+        net_reader->pathTaper(next_string());
+        break;
+      case Op::kPathTaperRule: {
+        const char* layer = next_string();
+        const char* rule = next_string();
+        net_reader->pathTaperRule(layer, rule);
+        break;
+      }
+      case Op::kPathPoint:
+        net_reader->pathPoint(args[0], args[1]);
+        break;
+      case Op::kPathPointExt:
+        net_reader->pathPoint(args[0], args[1], args[2]);
+        break;
+      case Op::kPathVirtualPoint:
+        net_reader->pathVirtualPoint(args[0], args[1]);
+        break;
+      case Op::kPathVia:
+        net_reader->pathVia(next_string());
+        break;
+      case Op::kPathViaRotated:
+        net_reader->pathVia(next_string(),
+                            dbOrientType((dbOrientType::Value) args[0]));
+        break;
+      case Op::kPathRect:
+        net_reader->pathRect(args[0], args[1], args[2], args[3]);
+        break;
+      case Op::kPathColor:
+        net_reader->pathColor(args[0]);
+        break;
+      case Op::kPathViaColor:
+        net_reader->pathViaColor(args[0], args[1], args[2]);
+        break;
+      case Op::kPathEnd:
+        net_reader->pathEnd();
+        break;
+      case Op::kWireEnd:
+        net_reader->wireEnd();
+        break;
+      case Op::kSource:
+        net_reader->source(dbSourceType((dbSourceType::Value) args[0]));
+        break;
+      case Op::kWeight:
+        net_reader->weight(args[0]);
+        break;
+      case Op::kFixedbump:
+        net_reader->fixedbump();
+        break;
+      case Op::kPropertyString: {
+        const char* name = next_string();
+        const char* value = next_string();
+        net_reader->property(name, value);
+        break;
+      }
+      case Op::kPropertyInt:
+        net_reader->property(next_string(), args[0]);
+        break;
+      case Op::kPropertyDouble:
+        net_reader->property(next_string(), doubles_[double_index++]);
+        break;
+      case Op::kEnd:
+        net_reader->end();
+        break;
+      case Op::kError:
+        if (!report_error(next_string())) {
+          return false;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+}  // namespace odb
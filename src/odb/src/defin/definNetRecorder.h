@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "odb/dbTypes.h"
+
+namespace utl {
+class Logger;
+}
+
+namespace odb {
+
+class definNet;
+
+// Stages the definNet calls made for a chunk of the NETS section so that the
+// chunk can be parsed on a worker thread and committed to the block later, in
+// file order, by the thread that owns the block.
+class definNetRecorder
+{
+ public:
+  // first_line is the line of the chunk's first net in the DEF file
+  definNetRecorder(utl::Logger* logger,
+                   bool continue_on_errors,
+                   int64_t first_line);
+
+  /// Net interface methods (see definNet)
+  void begin(const char* name);
+  void beginMustjoin(const char* iname, const char* pname);
+  void connection(const char* iname, const char* pname);
+  void nonDefaultRule(const char* rule);
+  void use(dbSigType type);
+  void wire(dbWireType type);
+  void path(const char* layer);
+  void pathTaper(const char* layer);
+  void pathTaperRule(const char* layer, const char* rule);
+  void pathPoint(int x, int y);
+  void pathPoint(int x, int y, int ext);
+  void pathVirtualPoint(int x, int y);
+  void pathVia(const char* via);
+  void pathVia(const char* via, dbOrientType orient);
+  void pathRect(int deltaX1, int deltaY1, int deltaX2, int deltaY2);
+  void pathColor(int color);
+  void pathViaColor(int bottom_color, int cut_color, int top_color);
+  void pathEnd();
+  void wireEnd();
+  void source(dbSourceType source);
+  void weight(int weight);
+  void fixedbump();
+  void property(const char* name, const char* value);
+  void property(const char* name, int value);
+  void property(const char* name, double value);
+  void end();
+
+  // Records an unsupported construct. Returns true if reading may continue.
+  bool error(const char* msg);
+
+  // Marks the chunk as not parsed to completion.
+  void setParseFailed() { parse_failed_ = true; }
+  bool parseFailed() const { return parse_failed_; }
+
+  utl::Logger* getLogger() const { return logger_; }
+  int64_t getFirstLine() const { return first_line_; }
+
+  // Replays the staged calls on net_reader. Recorded errors are reported
+  // through report_error, which returns true if reading may continue.
+  // Returns false if the replay was stopped by an error.
+  bool replay(definNet* net_reader,
+              const std::function<bool(const char*)>& report_error) const;
+
+ private:
+  enum class Op : uint8_t
+  {
+    kBegin,
+    kBeginMustjoin,
+    kConnection,
+    kNonDefaultRule,
+    kUse,
+    kWire,
+    kPath,
+    kPathTaper,
+    kPathTaperRule,
+    kPathPoint,
+    kPathPointExt,
+    kPathVirtualPoint,
+    kPathVia,
+    kPathViaRotated,
+    kPathRect,
+    kPathColor,
+    kPathViaColor,
+    kPathEnd,
+    kWireEnd,
+    kSource,
+    kWeight,
+    kFixedbump,
+    kPropertyString,
+    kPropertyInt,
+    kPropertyDouble,
+    kEnd,
+    kError
+  };
+
+  struct Call
+  {
+    Op op;
+    int args[4];
+  };
+
+  void record(Op op, int a = 0, int b = 0, int c = 0, int d = 0);
+  void addString(const char* str);
+
+  utl::Logger* logger_;
+  bool continue_on_errors_;
+  int64_t first_line_;
+  bool parse_failed_{false};
+  std::vector<Call> calls_;
+  // The string and double arguments of the calls, in call order.  They are
+  // read back sequentially so no per call offsets are stored.
+  std::string strings_;
+  std::vector<double> doubles_;
+};
+
+}  // namespace odb
@@ -3,14 +3,19 @@
 
 #include "definReader.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -41,6 +46,7 @@
 #include "definGCell.h"
 #include "definGroup.h"
 #include "definNet.h"
+#include "definNetRecorder.h"
 #include "definNonDefaultRule.h"
 #include "definPin.h"
 #include "definPinProps.h"
@@ -60,6 +66,7 @@
 #include "odb/defin.h"
 #include "odb/geom.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 #define UNSUPPORTED(msg)              \
   reader->error((msg));               \
@@ -703,52 +710,50 @@ int definReader::historyCallback(
   return PARSE_OK;
 }
 
-int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
-                             DefParser::defiNet* net,
-                             DefParser::defiUserData data)
-{
-  definReader* reader = (definReader*) data;
-  CHECKBLOCK
-  definNet* netR = reader->_netR.get();
-  if (reader->_mode == defin::FLOORPLAN
-      && reader->_block->findNet(net->name()) == nullptr) {
-    reader->_logger->warn(
-        utl::ODB,
-        275,
-        "skipping undefined net {} encountered in FLOORPLAN DEF",
-        net->name());
-    return PARSE_OK;
+// Transfers a parsed net to netR, which is either the definNet that builds the
+// db net or a definNetRecorder that stages the calls for a later replay.
+// error reports an unsupported construct and returns true if reading may
+// continue.
+#define NET_UNSUPPORTED(msg) \
+  if (!error((msg))) {       \
+    return PARSE_ERROR;      \
   }
+
+template <typename NET_READER, typename ERROR_FN>
+static int translateNet(DefParser::defiNet* net,
+                        NET_READER* netR,
+                        ERROR_FN error)
+{
   if (net->numShieldNets() > 0) {
-    UNSUPPORTED("SHIELDNET on net is unsupported");
+    NET_UNSUPPORTED("SHIELDNET on net is unsupported");
   }
 
   if (net->numVpins() > 0) {
-    UNSUPPORTED("VPIN on net is unsupported");
+    NET_UNSUPPORTED("VPIN on net is unsupported");
   }
 
   if (net->hasSubnets()) {
-    UNSUPPORTED("SUBNET on net is unsupported");
+    NET_UNSUPPORTED("SUBNET on net is unsupported");
   }
 
   if (net->hasXTalk()) {
-    UNSUPPORTED("XTALK on net is unsupported");
+    NET_UNSUPPORTED("XTALK on net is unsupported");
   }
 
   if (net->hasFrequency()) {
-    UNSUPPORTED("FREQUENCY on net is unsupported");
+    NET_UNSUPPORTED("FREQUENCY on net is unsupported");
   }
 
   if (net->hasOriginal()) {
-    UNSUPPORTED("ORIGINAL on net is unsupported");
+    NET_UNSUPPORTED("ORIGINAL on net is unsupported");
   }
 
   if (net->hasPattern()) {
-    UNSUPPORTED("PATTERN on net is unsupported");
+    NET_UNSUPPORTED("PATTERN on net is unsupported");
   }
 
   if (net->hasCap()) {
-    UNSUPPORTED("ESTCAP on net is unsupported");
+    NET_UNSUPPORTED("ESTCAP on net is unsupported");
   }
 
   netR->begin(net->name());
@@ -775,7 +780,7 @@ int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
 
   for (int i = 0; i < net->numConnections(); ++i) {
     if (net->pinIsSynthesized(i)) {
-      UNSUPPORTED("SYNTHESIZED on net's connection is unsupported");
+      NET_UNSUPPORTED("SYNTHESIZED on net's connection is unsupported");
     }
 
     if (net->pinIsMustJoin(i)) {
@@ -818,7 +823,8 @@ int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
             int nextId = path->next();
             if (nextId == DefParser::DEFIPATH_VIAROTATION) {
               netR->pathVia(viaName,
-                            translate_orientation(path->getViaRotation()));
+                            definBase::translate_orientation(
+                                path->getViaRotation()));
             } else {
               netR->pathVia(viaName);
               path->prev();  // put back the token
@@ -844,7 +850,7 @@ int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
           }
 
           case DefParser::DEFIPATH_STYLE:
-            UNSUPPORTED("styles are not supported on wires");
+            NET_UNSUPPORTED("styles are not supported on wires");
             break;
 
           case DefParser::DEFIPATH_RECT: {
@@ -876,7 +882,8 @@ int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
             break;
 
           default:
-            UNSUPPORTED("Unknown construct in net's routing is unsupported");
+            NET_UNSUPPORTED(
+                "Unknown construct in net's routing is unsupported");
             break;
         }
       }
@@ -893,6 +900,88 @@ int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+#undef NET_UNSUPPORTED
+
+int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
+                             DefParser::defiNet* net,
+                             DefParser::defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  if (reader->_mode == defin::FLOORPLAN
+      && reader->_block->findNet(net->name()) == nullptr) {
+    reader->_logger->warn(
+        utl::ODB,
+        275,
+        "skipping undefined net {} encountered in FLOORPLAN DEF",
+        net->name());
+    return PARSE_OK;
+  }
+  return translateNet(net, reader->_netR.get(), [reader](const char* msg) {
+    reader->error(msg);
+    return reader->_continue_on_errors;
+  });
+}
+
+int definReader::netRecordCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    DefParser::defiNet* net,
+    DefParser::defiUserData data)
+{
+  definNetRecorder* recorder = (definNetRecorder*) data;
+  return translateNet(net, recorder, [recorder](const char* msg) {
+    return recorder->error(msg);
+  });
+}
+
+int definReader::netsStartCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    int /* unused: number */,
+    DefParser::defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  if (reader->_staged_nets.empty()) {
+    return PARSE_OK;
+  }
+
+  // The NETS section was split into chunks that are parsed concurrently with
+  // the rest of the file.  Commit them in file order.
+  auto report_error = [reader](const char* msg) {
+    reader->error(msg);
+    return reader->_continue_on_errors;
+  };
+  for (size_t i = 0; i < reader->_staged_nets.size(); ++i) {
+    reader->_staged_net_futures[i].get();
+    const definNetRecorder* recorder = reader->_staged_nets[i].get();
+    if (!recorder->replay(reader->_netR.get(), report_error)) {
+      return PARSE_ERROR;
+    }
+    if (recorder->parseFailed()) {
+      UNSUPPORTED("NETS section could not be parsed");
+    }
+  }
+  reader->_staged_nets.clear();
+  reader->_staged_net_futures.clear();
+
+  // Resume the line count after the NETS section that was left out of the
+  // main parse.
+  DefParser::defrSetNLines(reader->_nets_end_line);
+
+  return PARSE_OK;
+}
+
+int definReader::netsRecordStartCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    int /* unused: number */,
+    DefParser::defiUserData data)
+{
+  // Report parser messages with the line numbers of the DEF file
+  definNetRecorder* recorder = (definNetRecorder*) data;
+  DefParser::defrSetNLines(recorder->getFirstLine());
+  return PARSE_OK;
+}
+
 int definReader::nonDefaultRuleCallback(
     DefParser::defrCallbackType_e /* unused: type */,
     DefParser::defiNonDefault* rule,
@@ -1813,6 +1902,21 @@ void definReader::contextWarningLogFunctionCallback(
   reader->_logger->warn(utl::ODB, 4, msg);
 }
 
+void definReader::recorderLogFunctionCallback(DefParser::defiUserData data,
+                                              const char* msg)
+{
+  definNetRecorder* recorder = (definNetRecorder*) data;
+  recorder->getLogger()->warn(utl::ODB, 1220, msg);
+}
+
+void definReader::recorderWarningLogFunctionCallback(
+    DefParser::defiUserData data,
+    const char* msg)
+{
+  definNetRecorder* recorder = (definNetRecorder*) data;
+  recorder->getLogger()->warn(utl::ODB, 1221, msg);
+}
+
 void definReader::line(int line_num)
 {
   _logger->info(utl::ODB, 125, "lines processed: {}", line_num);
@@ -1913,6 +2017,293 @@ static inline bool hasSuffix(const std::string& str, const std::string& suffix)
          && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
+// The parser reads staged DEF text through readTextPieces from the pieces
+// of the calling thread's active TextPieces.
+namespace {
+
+struct TextPieces
+{
+  std::vector<std::string_view> pieces;
+  size_t piece{0};
+  size_t offset{0};
+};
+
+thread_local TextPieces* active_text_pieces = nullptr;
+
+size_t readTextPieces(FILE* /* unused: file */, char* buffer, size_t size)
+{
+  TextPieces* text = active_text_pieces;
+  size_t count = 0;
+  while (count < size && text->piece < text->pieces.size()) {
+    const std::string_view piece = text->pieces[text->piece];
+    const size_t n = std::min(size - count, piece.size() - text->offset);
+    std::memcpy(buffer + count, piece.data() + text->offset, n);
+    count += n;
+    text->offset += n;
+    if (text->offset == piece.size()) {
+      ++text->piece;
+      text->offset = 0;
+    }
+  }
+  return count;
+}
+
+int readPieces(std::vector<std::string_view> pieces,
+               const char* file,
+               DefParser::defiUserData data)
+{
+  TextPieces text{std::move(pieces)};
+  active_text_pieces = &text;
+  DefParser::defrSetReadFunction(readTextPieces);
+  const int res
+      = DefParser::defrRead(nullptr, file, data, /* case sensitive */ 1);
+  DefParser::defrUnsetReadFunction();
+  active_text_pieces = nullptr;
+  return res;
+}
+
+// Splits DEF text into tokens the way the DEF lexer does: tokens are
+// separated by blanks, a token starting with '"' runs to the closing quote
+// (skipping backslash escapes) and a token starting with '#' comments out the
+// rest of the line.  Comments are skipped; an empty token marks the end.
+class DefTokenizer
+{
+ public:
+  DefTokenizer(std::string_view text, size_t pos, int64_t line)
+      : text_(text), pos_(pos), line_(line)
+  {
+  }
+
+  std::string_view next()
+  {
+    while (true) {
+      skipBlanks();
+      if (pos_ == text_.size()) {
+        begin_ = pos_;
+        return {};
+      }
+      begin_ = pos_;
+      token_line_ = line_;
+      if (text_[pos_] == '#') {
+        pos_ = std::min(text_.find('\n', pos_), text_.size());
+        continue;
+      }
+      if (text_[pos_] == '"') {
+        for (++pos_; pos_ < text_.size() && text_[pos_] != '"'; ++pos_) {
+          if (text_[pos_] == '\\') {
+            ++pos_;
+          }
+        }
+        pos_ = std::min(pos_ + 1, text_.size());
+      } else {
+        while (pos_ < text_.size() && !isBlank(text_[pos_])) {
+          ++pos_;
+        }
+      }
+      return text_.substr(begin_, pos_ - begin_);
+    }
+  }
+
+  // Start and line of the last token
+  size_t tokenBegin() const { return begin_; }
+  int64_t tokenLine() const { return token_line_; }
+  // Just past the last token
+  size_t pos() const { return pos_; }
+
+ private:
+  static bool isBlank(const char ch)
+  {
+    return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r';
+  }
+
+  void skipBlanks()
+  {
+    for (; pos_ < text_.size() && isBlank(text_[pos_]); ++pos_) {
+      if (text_[pos_] == '\n') {
+        ++line_;
+      }
+    }
+  }
+
+  std::string_view text_;
+  size_t pos_;
+  size_t begin_{0};
+  int64_t line_;
+  int64_t token_line_{0};
+};
+
+}  // namespace
+
+// Splits the NETS section of a plain DEF file into chunks of whole net
+// statements and starts parsing them on the thread pool.  The chunks and the
+// main parse read views of _def_text, which holds the only copy of the file.
+// The main parse sees an empty NETS section and commits the staged nets when
+// it reaches it.  Returns false if the NETS section is too small to be worth
+// splitting or can't be split into statements unambiguously.
+bool definReader::stageNets(const char* file)
+{
+  std::ifstream in(file, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  _def_text.assign(std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>());
+  const std::string_view text = _def_text;
+
+  // Global statements every chunk needs to be parsed on its own
+  static const std::vector<std::string_view> header_keywords = {
+      "VERSION",
+      "NAMESCASESENSITIVE",
+      "DIVIDERCHAR",
+      "BUSBITCHARS",
+      "DESIGN",
+      "UNITS",
+  };
+
+  bool in_prop_defs = false;
+  size_t section_begin = std::string::npos;
+  size_t section_end = std::string::npos;
+  size_t content_end = std::string::npos;
+  int64_t line_num = 1;
+  _def_header.clear();
+  for (size_t pos = 0; pos < text.size(); ++line_num) {
+    size_t eol = text.find('\n', pos);
+    eol = (eol == std::string::npos) ? text.size() : eol + 1;
+    const std::string_view line = text.substr(pos, eol - pos);
+    std::string_view token;
+    const size_t first = line.find_first_not_of(" \t\r");
+    if (first != std::string_view::npos) {
+      const size_t last = line.find_first_of(" \t\r\n;", first);
+      token = line.substr(first, last - first);
+    }
+
+    if (in_prop_defs) {
+      _def_header.append(line);
+      in_prop_defs = token != "END";
+    } else if (token == "PROPERTYDEFINITIONS") {
+      _def_header.append(line);
+      in_prop_defs = true;
+    } else if (std::ranges::find(header_keywords, token)
+               != header_keywords.end()) {
+      _def_header.append(line);
+    } else if (token == "NETS") {
+      section_begin = pos;
+      break;
+    }
+    pos = eol;
+  }
+
+  // Net statements run from a "-" token to a ";" token.  Anything else
+  // between them (eg an &alias) could change where the statements end, so
+  // such sections are left to the serial parse.
+  std::vector<size_t> statements;
+  std::vector<int64_t> statement_lines;
+  if (section_begin != std::string::npos) {
+    DefTokenizer tokens(text, section_begin, line_num);
+    bool valid = tokens.next() == "NETS" && !tokens.next().empty()
+                 && tokens.next() == ";";
+    while (valid) {
+      const std::string_view token = tokens.next();
+      if (token == "-") {
+        statements.push_back(tokens.tokenBegin());
+        statement_lines.push_back(tokens.tokenLine());
+        std::string_view statement_token;
+        do {
+          statement_token = tokens.next();
+        } while (!statement_token.empty() && statement_token != ";");
+        valid = !statement_token.empty();
+      } else if (token == "END") {
+        content_end = tokens.tokenBegin();
+        if (tokens.next() == "NETS") {
+          section_end = tokens.pos();
+          _nets_end_line = tokens.tokenLine();
+        }
+        break;
+      } else {
+        valid = false;
+      }
+    }
+  }
+
+  const size_t max_chunks = statements.size() / _min_nets_per_chunk;
+  const size_t num_chunks
+      = std::min(max_chunks, (size_t) _threads * kChunksPerThread);
+  if (section_end == std::string::npos || num_chunks < 2) {
+    _def_text.clear();
+    _def_text.shrink_to_fit();
+    _def_header.clear();
+    return false;
+  }
+
+  debugPrint(_logger,
+             utl::ODB,
+             "defin",
+             1,
+             "Parsing {} nets in {} chunks on {} threads.",
+             statements.size(),
+             num_chunks,
+             _threads);
+
+  _thread_pool = std::make_unique<utl::ThreadPool>(_threads);
+  const size_t target_size = (content_end - statements[0]) / num_chunks;
+  size_t chunk_begin = 0;
+  for (size_t i = 1; i <= statements.size(); ++i) {
+    const size_t begin = statements[chunk_begin];
+    const size_t end
+        = (i == statements.size()) ? content_end : statements[i];
+    if (i < statements.size() && end - begin < target_size) {
+      continue;
+    }
+
+    // The NETS statement shares the line of the first net so the parser
+    // line number can be set to the line of that net at the NETS callback.
+    std::string nets = fmt::format("NETS {} ; ", i - chunk_begin);
+    const std::string_view body = text.substr(begin, end - begin);
+    _staged_nets.push_back(std::make_unique<definNetRecorder>(
+        _logger, _continue_on_errors, statement_lines[chunk_begin]));
+    chunk_begin = i;
+
+    definNetRecorder* recorder = _staged_nets.back().get();
+    _staged_net_futures.push_back(_thread_pool->submit(
+        [this, nets = std::move(nets), body, file, recorder]() {
+          parseNetChunk(
+              {_def_header, nets, body, "END NETS\nEND DESIGN\n"},
+              file,
+              recorder);
+        }));
+  }
+
+  _main_pieces = {text.substr(0, section_begin),
+                  "NETS 0 ; END NETS",
+                  text.substr(section_end)};
+
+  return true;
+}
+
+void definReader::parseNetChunk(std::vector<std::string_view> pieces,
+                                const char* file,
+                                definNetRecorder* recorder)
+{
+  // The parser state is thread local so each worker runs its own session.
+  DefParser::defrInit();
+  DefParser::defrReset();
+
+  DefParser::defrInitSession();
+  DefParser::defrSetNetStartCbk(netsRecordStartCallback);
+  DefParser::defrSetNetCbk(netRecordCallback);
+  DefParser::defrSetContextLogFunction(recorderLogFunctionCallback);
+  DefParser::defrSetContextWarningLogFunction(
+      recorderWarningLogFunctionCallback);
+  DefParser::defrSetAddPathToNet();
+
+  if (readPieces(std::move(pieces), file, (DefParser::defiUserData) recorder)
+      != 0) {
+    recorder->setParseFailed();
+  }
+
+  DefParser::defrClear();
+}
+
 bool definReader::createBlock(const char* file)
 {
   DefParser::defrInit();
@@ -1975,8 +2366,20 @@ bool definReader::createBlock(const char* file)
   }
 
   bool isZipped = hasSuffix(file, ".gz");
+
+  // Nets of large DEF files are parsed in parallel and committed in order
+  // when the main parse reaches the NETS section.
+  const bool staged = !isZipped && _threads > 1 && _mode == defin::DEFAULT
+                      && stageNets(file);
+  if (staged) {
+    defrSetNetStartCbk(netsStartCallback);
+  }
+
   int res;
-  if (!isZipped) {
+  if (staged) {
+    res = readPieces(
+        std::move(_main_pieces), file, (DefParser::defiUserData) this);
+  } else if (!isZipped) {
     FILE* f = fopen(file, "r");
     if (f == nullptr) {
       _logger->warn(utl::ODB, 148, "error: Cannot open DEF file {}", file);
@@ -1997,6 +2400,20 @@ bool definReader::createBlock(const char* file)
     DefParser::defGZipClose(f);
   }
 
+  // Chunks are left uncommitted if the parse stopped before NETS
+  for (auto& future : _staged_net_futures) {
+    if (future.valid()) {
+      future.wait();
+    }
+  }
+  _staged_net_futures.clear();
+  _staged_nets.clear();
+  _thread_pool.reset();
+  _main_pieces.clear();
+  _def_header.clear();
+  _def_text.clear();
+  _def_text.shrink_to_fit();
+
   if (res != 0 || errors() != 0) {
     if (!_continue_on_errors) {
       _logger->error(utl::ODB, 421, "DEF parser returns an error!");
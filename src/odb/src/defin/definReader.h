@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -24,9 +27,11 @@
 #include "defiSite.hpp"
 #include "defiVia.hpp"
 #include "definBase.h"
+#include "definNetRecorder.h"
 #include "defrReader.hpp"
 #include "odb/db.h"
 #include "odb/defin.h"
+#include "utl/ThreadPool.h"
 
 namespace utl {
 class Logger;
@@ -67,6 +72,11 @@ class definReader : public definBase
   void skipFillWires();
   void continueOnErrors();
   void useBlockName(const char* name);
+  void setThreads(int threads) { _threads = threads; }
+  void setMinNetsPerChunk(int nets)
+  {
+    _min_nets_per_chunk = std::max(nets, 1);
+  }
   void error(std::string_view msg);
 
   void readChip(std::vector<dbLib*>& search_libs,
@@ -87,6 +97,12 @@ class definReader : public definBase
   bool createBlock(const char* file);
   int errors();
 
+  // Parallel NETS parsing
+  bool stageNets(const char* file);
+  static void parseNetChunk(std::vector<std::string_view> pieces,
+                            const char* file,
+                            definNetRecorder* recorder);
+
   // Parser callbacks
   static int blockageCallback(DefParser::defrCallbackType_e type,
                               DefParser::defiBlockage* blockage,
@@ -140,6 +156,18 @@ class definReader : public definBase
                          DefParser::defiNet* net,
                          DefParser::defiUserData data);
 
+  static int netRecordCallback(DefParser::defrCallbackType_e type,
+                               DefParser::defiNet* net,
+                               DefParser::defiUserData data);
+
+  static int netsStartCallback(DefParser::defrCallbackType_e type,
+                               int number,
+                               DefParser::defiUserData data);
+
+  static int netsRecordStartCallback(DefParser::defrCallbackType_e type,
+                                     int number,
+                                     DefParser::defiUserData data);
+
   static int nonDefaultRuleCallback(DefParser::defrCallbackType_e type,
                                     DefParser::defiNonDefault* rule,
                                     DefParser::defiUserData data);
@@ -236,6 +264,12 @@ class definReader : public definBase
   static void contextWarningLogFunctionCallback(DefParser::defiUserData data,
                                                 const char* msg);
 
+  static void recorderLogFunctionCallback(DefParser::defiUserData data,
+                                          const char* msg);
+
+  static void recorderWarningLogFunctionCallback(DefParser::defiUserData data,
+                                                 const char* msg);
+
   dbDatabase* _db;
   dbChip* chip_{nullptr};
   std::unique_ptr<definBlockage> _blockageR;
@@ -261,6 +295,20 @@ class definReader : public definBase
   char hier_delimiter_{0};
   char left_bus_delimiter_{0};
   char right_bus_delimiter_{0};
+
+  static constexpr size_t kMinNetsPerChunk = 1000;
+  static constexpr int kChunksPerThread = 4;
+  int _threads{1};
+  size_t _min_nets_per_chunk{kMinNetsPerChunk};
+  // The DEF file while its NETS section is parsed in parallel
+  std::string _def_text;
+  // The global statements of _def_text that every chunk starts with
+  std::string _def_header;
+  std::vector<std::string_view> _main_pieces;
+  int64_t _nets_end_line{0};
+  std::unique_ptr<utl::ThreadPool> _thread_pool;
+  std::vector<std::unique_ptr<definNetRecorder>> _staged_nets;
+  std::vector<utl::ThreadPoolFuture<void>> _staged_net_futures;
 };
 
 }  // namespace odb
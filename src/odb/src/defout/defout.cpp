@@ -34,6 +34,16 @@ void DefOut::setVersion(Version v)
   writer_->setVersion(v);
 }
 
+void DefOut::setThreads(int threads)
+{
+  writer_->setThreads(threads);
+}
+
+void DefOut::setMinItemsPerChunk(int items)
+{
+  writer_->setMinItemsPerChunk(items);
+}
+
 bool DefOut::writeBlock(dbBlock* block, const char* def_file)
 {
   return writer_->writeBlock(block, def_file);
@@ -17,6 +17,7 @@
 #include <optional>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -34,6 +35,7 @@
 #include "odb/geom.h"
 #include "utl/Logger.h"
 #include "utl/ScopedTemporaryFile.h"
+#include "utl/ThreadPool.h"
 
 namespace odb {
 
@@ -64,6 +66,9 @@ std::string getScanPinDef(dbITerm* iterm)
 
 static const int max_name_length = 256;
 
+// Tasks per thread so that chunks with long wires don't stall the others.
+constexpr int kChunksPerThread = 4;
+
 template <typename T>
 std::vector<T*> sortedSet(dbSet<T>& to_sort)
 {
@@ -270,6 +275,47 @@ bool DefOut::Impl::writeBlock(dbBlock* block, std::ostream& stream)
   return true;
 }
 
+template <typename T, typename WriteItem>
+void DefOut::Impl::writeItems(const std::vector<T*>& items,
+                              WriteItem write_item)
+{
+  const int item_count = items.size();
+  const int chunk_count = std::min(_threads * kChunksPerThread,
+                                   item_count / _min_items_per_chunk);
+  if (_threads <= 1 || chunk_count <= 1) {
+    for (T* item : items) {
+      write_item(*this, item);
+    }
+    return;
+  }
+
+  // Each task formats its chunk with a private copy of the writer state
+  // (_out, _non_default_rule) into a string; the block is only read.
+  utl::ThreadPool pool(_threads);
+  std::vector<utl::ThreadPoolFuture<std::string>> chunks;
+  chunks.reserve(chunk_count);
+  for (int chunk = 0; chunk < chunk_count; chunk++) {
+    const int begin = (int64_t) item_count * chunk / chunk_count;
+    const int end = (int64_t) item_count * (chunk + 1) / chunk_count;
+    chunks.push_back(pool.submit([this, &items, &write_item, begin, end]() {
+      std::ostringstream buffer;
+      Impl writer(*this);
+      writer._out = &buffer;
+      for (int i = begin; i < end; i++) {
+        write_item(writer, items[i]);
+      }
+      return std::move(buffer).str();
+    }));
+  }
+
+  // Append in order as chunks complete so that only the chunks ahead of the
+  // output position are held in memory.
+  for (utl::ThreadPoolFuture<std::string>& chunk : chunks) {
+    const std::string text = chunk.get();
+    _out->write(text.data(), text.size());
+  }
+}
+
 bool DefOut::Impl::writeBlock(dbBlock* block, const char* def_file)
 {
   utl::OutStreamHandler stream_handler(def_file, false);
@@ -506,12 +552,16 @@ void DefOut::Impl::writeInsts(dbBlock* block)
   *_out << "COMPONENTS " << inst_cnt << " ;\n";
 
   // Sort the components for consistent output
+  std::vector<dbInst*> selected_insts;
+  selected_insts.reserve(inst_cnt);
   for (dbInst* inst : sorted_insts) {
     if (_select_inst_map && !(*_select_inst_map)[inst]) {
       continue;
     }
-    writeInst(inst);
+    selected_insts.push_back(inst);
   }
+  writeItems(selected_insts,
+             [](Impl& writer, dbInst* inst) { writer.writeInst(inst); });
 
   *_out << "END COMPONENTS\n";
 }
@@ -1339,29 +1389,38 @@ void DefOut::Impl::writeNets(dbBlock* block)
   if (snet_cnt > 0) {
     *_out << "SPECIALNETS " << snet_cnt << " ;\n";
 
+    std::vector<dbNet*> snets;
+    snets.reserve(snet_cnt);
     for (dbNet* net : sorted_nets) {
       if (_select_net_map && !(*_select_net_map)[net]) {
         continue;
       }
       if (net->isSpecial()) {
-        writeSNet(net, snet_term_map);
+        snets.push_back(net);
       }
     }
+    writeItems(snets, [&snet_term_map](Impl& writer, dbNet* net) {
+      writer.writeSNet(net, snet_term_map);
+    });
 
     *_out << "END SPECIALNETS\n";
   }
 
   *_out << "NETS " << net_cnt << " ;\n";
 
+  std::vector<dbNet*> regular_nets;
+  regular_nets.reserve(net_cnt);
   for (dbNet* net : sorted_nets) {
     if (_select_net_map && !(*_select_net_map)[net]) {
       continue;
     }
 
     if (regular_net[net] == 1) {
-      writeNet(net);
+      regular_nets.push_back(net);
     }
   }
+  writeItems(regular_nets,
+             [](Impl& writer, dbNet* net) { writer.writeNet(net); });
 
   *_out << "END NETS\n";
 }
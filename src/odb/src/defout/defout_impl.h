@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <list>
 #include <map>
@@ -10,6 +11,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "odb/PtrSetMap.h"
 #include "odb/db.h"
@@ -40,6 +42,11 @@ class DefOut::Impl
   void selectInst(dbInst* inst);
 
   void setVersion(DefOut::Version v) { _version = v; }
+  void setThreads(int threads) { _threads = threads; }
+  void setMinItemsPerChunk(int items)
+  {
+    _min_items_per_chunk = std::max(items, 1);
+  }
 
   bool writeBlock(dbBlock* block, const char* def_file);
   bool writeBlock(dbBlock* block, std::ostream& stream);
@@ -98,6 +105,11 @@ class DefOut::Impl
   void writePinProperties(dbBlock* block);
   bool hasProperties(dbObject* object, ObjType type);
 
+  // Formats items with write_item on _threads threads, each chunk into its
+  // own buffer, and appends the buffers to _out in item order.
+  template <typename T, typename WriteItem>
+  void writeItems(const std::vector<T*>& items, WriteItem write_item);
+
   double _dist_factor{0};
   std::ostream* _out{nullptr};
   std::list<dbNet*> _select_net_list;
@@ -108,6 +120,9 @@ class DefOut::Impl
   DefOut::Version _version{DefOut::DEF_5_8};
   std::map<std::string, bool> _prop_defs[9];
   utl::Logger* _logger;
+  int _threads{1};
+  // Smallest number of components/nets formatted by one parallel task
+  int _min_items_per_chunk{1000};
 };
 
 }  // namespace odb
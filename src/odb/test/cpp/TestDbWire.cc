@@ -4,6 +4,9 @@
 #include <unistd.h>
 
 #include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
 
 #include "gtest/gtest.h"
 #include "odb/db.h"
@@ -30,6 +33,21 @@ class OdbMultiPatternedTest : public tst::Fixture
     block_->setDieArea(odb::Rect(0, 0, 1000, 1000));
   }
 
+  // Creates a net named "net" with a single vertical met1 wire.
+  odb::dbNet* createRoutedNet()
+  {
+    odb::dbTechLayer* met1 = lib_->getTech()->findLayer("met1");
+    odb::dbNet* net = odb::dbNet::create(block_, "net");
+    odb::dbWire* wire = odb::dbWire::create(net);
+    odb::dbWireEncoder encoder;
+    encoder.begin(wire);
+    encoder.newPath(met1, odb::dbWireType::ROUTED);
+    encoder.addPoint(0, 0);
+    encoder.addPoint(0, 100000);
+    encoder.end();
+    return net;
+  }
+
   odb::dbLib* lib_;
   odb::dbChip* chip_;
   odb::dbBlock* block_;
@@ -191,4 +209,141 @@ TEST_F(OdbMultiPatternedTest, GetSegmentWithColinearExtension)
   EXPECT_EQ(shape.getBox(), expected);
 }
 
+TEST_F(OdbMultiPatternedTest, ReadDbSkipWires)
+{
+  dbNet* net = createRoutedNet();
+  dbWire* wire = net->getWire();
+
+  std::stringstream stream;
+  db_->write(stream, 4);
+
+  for (const int threads : {1, 4}) {
+    for (const bool skip_wires : {false, true}) {
+      stream.clear();
+      stream.seekg(0);
+      dbDatabase* db = dbDatabase::create();
+      db->read(stream, threads, skip_wires);
+      dbNet* read_net = db->getChip()->getBlock()->findNet("net");
+      ASSERT_NE(read_net, nullptr);
+      if (skip_wires) {
+        EXPECT_EQ(read_net->getWire(), nullptr);
+      } else {
+        ASSERT_NE(read_net->getWire(), nullptr);
+        EXPECT_EQ(read_net->getWire()->length(), wire->length());
+      }
+      dbDatabase::destroy(db);
+    }
+  }
+}
+
+TEST_F(OdbMultiPatternedTest, ReadDbSkipParasitics)
+{
+  block_->setCornerCount(1);
+  dbNet* net = createRoutedNet();
+  dbWire* wire = net->getWire();
+  dbCapNode* source = dbCapNode::create(net, 1, true);
+  source->setCapacitance(1.5, 0);
+  dbCapNode* target = dbCapNode::create(net, 2, true);
+  target->setCapacitance(2.5, 0);
+  dbRSeg* seg = dbRSeg::create(net, 0, 100000, 0, true);
+  seg->setSourceNode(source->getId());
+  seg->setTargetNode(target->getId());
+  seg->setResistance(10.0, 0);
+
+  std::stringstream stream;
+  db_->write(stream, 4);
+
+  for (const int threads : {1, 4}) {
+    for (const bool skip_parasitics : {false, true}) {
+      stream.clear();
+      stream.seekg(0);
+      dbDatabase* db = dbDatabase::create();
+      db->read(stream, threads, false, skip_parasitics);
+      dbBlock* block = db->getChip()->getBlock();
+      dbNet* read_net = block->findNet("net");
+      ASSERT_NE(read_net, nullptr);
+      ASSERT_NE(read_net->getWire(), nullptr);
+      EXPECT_EQ(read_net->getWire()->length(), wire->length());
+      if (skip_parasitics) {
+        EXPECT_TRUE(read_net->getCapNodes().empty());
+        EXPECT_TRUE(read_net->getRSegs().empty());
+        EXPECT_TRUE(block->getCapNodes().empty());
+        EXPECT_TRUE(block->getRSegs().empty());
+      } else {
+        ASSERT_EQ(read_net->getCapNodes().size(), 2);
+        ASSERT_EQ(read_net->getRSegs().size(), 1);
+        dbCapNode* read_source = dbCapNode::getCapNode(block, source->getId());
+        EXPECT_FLOAT_EQ(read_source->getCapacitance(0), 1.5);
+        dbCapNode* read_target = dbCapNode::getCapNode(block, target->getId());
+        EXPECT_FLOAT_EQ(read_target->getCapacitance(0), 2.5);
+        dbRSeg* read_seg = *read_net->getRSegs().begin();
+        EXPECT_EQ(read_seg->getSourceNode(), source->getId());
+        EXPECT_EQ(read_seg->getTargetNode(), target->getId());
+        EXPECT_FLOAT_EQ(read_seg->getResistance(0), 10.0);
+      }
+      dbDatabase::destroy(db);
+    }
+  }
+}
+
+// Collects what is written to it but, like a compressor, can't seek.
+class UnseekableBuffer : public std::streambuf
+{
+ public:
+  const std::string& str() const { return data_; }
+
+ protected:
+  std::streamsize xsputn(const char* s, std::streamsize n) override
+  {
+    data_.append(s, n);
+    return n;
+  }
+
+  int_type overflow(int_type ch) override
+  {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      data_.push_back(traits_type::to_char_type(ch));
+    }
+    return traits_type::not_eof(ch);
+  }
+
+ private:
+  std::string data_;
+};
+
+// The sectioned block tables are written the same way with one or more
+// threads, to a file that can seek or not, and read back the same way with
+// one or more threads.
+TEST_F(OdbMultiPatternedTest, WriteReadDbSections)
+{
+  dbNet* net = createRoutedNet();
+  dbWire* wire = net->getWire();
+  dbBlockage::create(block_, 0, 0, 500, 500);
+
+  std::stringstream serial;
+  db_->write(serial, 1);
+  std::stringstream parallel;
+  db_->write(parallel, 4);
+  EXPECT_EQ(serial.str(), parallel.str());
+  UnseekableBuffer unseekable_buffer;
+  std::ostream unseekable(&unseekable_buffer);
+  db_->write(unseekable, 1);
+  EXPECT_EQ(serial.str(), unseekable_buffer.str());
+
+  for (const int threads : {1, 4}) {
+    std::stringstream stream(serial.str());
+    dbDatabase* db = dbDatabase::create();
+    db->read(stream, threads);
+    dbBlock* block = db->getChip()->getBlock();
+    dbNet* read_net = block->findNet("net");
+    ASSERT_NE(read_net, nullptr);
+    ASSERT_NE(read_net->getWire(), nullptr);
+    EXPECT_EQ(read_net->getWire()->length(), wire->length());
+    ASSERT_EQ(block->getBlockages().size(), 1);
+    EXPECT_EQ((*block->getBlockages().begin())->getBBox()->getBox(),
+              Rect(0, 0, 500, 500));
+    dbDatabase::destroy(db);
+  }
+}
+
 }  // namespace odb
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/defout.h"
+#include "tst/nangate45_fixture.h"
+
+namespace odb {
+namespace {
+
+class DefThreadsTest : public tst::Nangate45Fixture
+{
+ protected:
+  std::string gcdPath() const
+  {
+    return getFilePath("_main/src/odb/test/data/gcd/gcd_nangate45_route.def");
+  }
+
+  // Reads the routed gcd design into a new chip.  A low min_nets_per_chunk
+  // makes the reader split the 439 nets into chunks parsed in parallel.
+  dbBlock* readDef(const char* chip_name,
+                   const int threads,
+                   const int min_nets_per_chunk)
+  {
+    return readDef(chip_name, threads, min_nets_per_chunk, gcdPath());
+  }
+
+  dbBlock* readDef(const char* chip_name,
+                   const int threads,
+                   const int min_nets_per_chunk,
+                   const std::string& path)
+  {
+    dbChip* chip = dbChip::create(db_.get(), db_->getTech(), chip_name);
+    defin reader(db_.get(), &logger_);
+    reader.setThreads(threads);
+    reader.setMinNetsPerChunk(min_nets_per_chunk);
+    std::vector<dbLib*> libs{lib_};
+    reader.readChip(libs, path.c_str(), chip);
+    return chip->getBlock();
+  }
+
+  // A low min_items_per_chunk makes the writer format the components and
+  // nets in parallel chunks.
+  std::string writeDef(dbBlock* block,
+                       const char* file_name,
+                       const int threads = 1,
+                       const int min_items_per_chunk = 1000)
+  {
+    const std::string path = testing::TempDir() + file_name;
+    DefOut writer(&logger_);
+    writer.setThreads(threads);
+    writer.setMinItemsPerChunk(min_items_per_chunk);
+    EXPECT_TRUE(writer.writeBlock(block, path.c_str()));
+    std::ifstream in(path);
+    return {std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>()};
+  }
+};
+
+TEST_F(DefThreadsTest, ParallelNetsMatchSerialRead)
+{
+  dbBlock* serial = readDef("serial", 1, 10);
+  ASSERT_NE(serial, nullptr);
+  ASSERT_EQ(serial->getNets().size(), 439);
+
+  for (const int threads : {2, 4}) {
+    const std::string chip_name = "parallel" + std::to_string(threads);
+    dbBlock* parallel = readDef(chip_name.c_str(), threads, 10);
+    ASSERT_NE(parallel, nullptr);
+    ASSERT_EQ(parallel->getNets().size(), serial->getNets().size());
+    for (dbNet* net : serial->getNets()) {
+      dbNet* parallel_net = parallel->findNet(net->getConstName());
+      ASSERT_NE(parallel_net, nullptr);
+      EXPECT_EQ(parallel_net->getId(), net->getId());
+      EXPECT_EQ(parallel_net->getITerms().size(), net->getITerms().size());
+      EXPECT_EQ(parallel_net->getBTerms().size(), net->getBTerms().size());
+      if (net->getWire() == nullptr) {
+        EXPECT_EQ(parallel_net->getWire(), nullptr);
+      } else {
+        ASSERT_NE(parallel_net->getWire(), nullptr);
+        EXPECT_EQ(parallel_net->getWire()->length(), net->getWire()->length());
+      }
+    }
+    EXPECT_EQ(writeDef(parallel, "parallel_read.def"),
+              writeDef(serial, "serial_read.def"));
+  }
+}
+
+// Replaces every from in text with to.
+std::string replaceAll(std::string text,
+                       const std::string& from,
+                       const std::string& to)
+{
+  for (size_t pos = text.find(from); pos != std::string::npos;
+       pos = text.find(from, pos + to.size())) {
+    text.replace(pos, from.size(), to);
+  }
+  return text;
+}
+
+// Net statements are split on their ";" so several statements on one line,
+// continuation lines starting with "-" and ";" in comments or strings don't
+// move the chunk boundaries.
+TEST_F(DefThreadsTest, ParallelNetsSplitOnStatementEnds)
+{
+  std::ifstream in(gcdPath());
+  std::string text{std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>()};
+  text = replaceAll(text,
+                    "UNITS DISTANCE MICRONS 2000 ;\n",
+                    "UNITS DISTANCE MICRONS 2000 ;\n"
+                    "PROPERTYDEFINITIONS\n"
+                    "  NET weight INTEGER ;\n"
+                    "  NET note STRING ;\n"
+                    "END PROPERTYDEFINITIONS\n");
+  const size_t nets_begin = text.find("\nNETS ");
+  const size_t nets_end = text.find("END NETS");
+  ASSERT_NE(nets_begin, std::string::npos);
+  ASSERT_NE(nets_end, std::string::npos);
+  std::string nets = text.substr(nets_begin, nets_end - nets_begin);
+  nets = replaceAll(nets, " ;\n    - ", " ; - ");
+  nets = replaceAll(nets,
+                    " + USE SIGNAL\n",
+                    " + USE SIGNAL + PROPERTY weight\n"
+                    "-1 # not the end ;\n"
+                    " + PROPERTY note \"a ; - b\"\n");
+  text = text.substr(0, nets_begin) + nets + text.substr(nets_end);
+
+  const std::string path = testing::TempDir() + "statement_ends.def";
+  std::ofstream(path) << text;
+
+  dbBlock* serial = readDef("serial", 1, 10, path);
+  ASSERT_NE(serial, nullptr);
+  ASSERT_EQ(serial->getNets().size(), 439);
+  dbNet* serial_net = serial->findNet("_000_");
+  ASSERT_NE(serial_net, nullptr);
+  dbIntProperty* weight = dbIntProperty::find(serial_net, "weight");
+  ASSERT_NE(weight, nullptr);
+  EXPECT_EQ(weight->getValue(), -1);
+  dbStringProperty* note = dbStringProperty::find(serial_net, "note");
+  ASSERT_NE(note, nullptr);
+  EXPECT_EQ(note->getValue(), "a ; - b");
+
+  for (const int threads : {2, 4}) {
+    const std::string chip_name = "parallel" + std::to_string(threads);
+    dbBlock* parallel = readDef(chip_name.c_str(), threads, 10, path);
+    ASSERT_NE(parallel, nullptr);
+    ASSERT_EQ(parallel->getNets().size(), serial->getNets().size());
+    for (dbNet* net : serial->getNets()) {
+      dbNet* parallel_net = parallel->findNet(net->getConstName());
+      ASSERT_NE(parallel_net, nullptr);
+      EXPECT_EQ(parallel_net->getId(), net->getId());
+    }
+    EXPECT_EQ(writeDef(parallel, "parallel_statement_ends.def"),
+              writeDef(serial, "serial_statement_ends.def"));
+  }
+}
+
+TEST_F(DefThreadsTest, ParallelWriteMatchesSerialWrite)
+{
+  dbBlock* block = readDef("gcd", 1, 1000);
+  ASSERT_NE(block, nullptr);
+
+  const std::string serial = writeDef(block, "serial_write.def");
+  ASSERT_NE(serial.find("END NETS"), std::string::npos);
+  for (const int threads : {2, 4}) {
+    EXPECT_EQ(writeDef(block, "parallel_write.def", threads, 10), serial);
+  }
+}
+
+}  // namespace
+}  // namespace odb
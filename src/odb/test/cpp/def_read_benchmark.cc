@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+// Times reading a DEF file with the serial reader and with the NETS section
+// parsed on 2, 4, ... threads, and checks that every read finds the same
+// number of nets.  The LEF is read into a fresh database before each timed
+// DEF read.
+//
+// usage: def_read_benchmark lef_file def_file [max_threads] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "spdlog/fmt/fmt.h"
+#include "utl/Logger.h"
+
+namespace {
+
+struct ReadResult
+{
+  double ms;
+  int nets;
+};
+
+ReadResult readDef(utl::Logger* logger,
+                   const char* lef_file,
+                   const char* def_file,
+                   int threads)
+{
+  odb::dbDatabase* db = odb::dbDatabase::create();
+  db->setLogger(logger);
+  odb::lefin lef_reader(db, logger, false);
+  odb::dbLib* lib = lef_reader.createTechAndLib("tech", "lib", lef_file);
+  std::vector<odb::dbLib*> libs{lib};
+  odb::dbChip* chip = odb::dbChip::create(db, db->getTech());
+
+  const auto start = std::chrono::steady_clock::now();
+  odb::defin def_reader(db, logger);
+  def_reader.setThreads(threads);
+  def_reader.readChip(libs, def_file, chip);
+  const std::chrono::duration<double, std::milli> elapsed
+      = std::chrono::steady_clock::now() - start;
+
+  const int nets = chip->getBlock()->getNets().size();
+  odb::dbDatabase::destroy(db);
+  return {elapsed.count(), nets};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3) {
+    std::cerr << "usage: def_read_benchmark lef_file def_file [max_threads] "
+                 "[iterations]\n";
+    return 1;
+  }
+  const char* lef_file = argv[1];
+  const char* def_file = argv[2];
+  const int max_threads = (argc > 3) ? std::max(1, std::atoi(argv[3])) : 8;
+  const int iterations = (argc > 4) ? std::max(1, std::atoi(argv[4])) : 3;
+
+  utl::Logger logger;
+  // Keep the LEF and DEF readers' progress messages out of the table.
+  for (const int id : {94,  97,  125, 127, 128, 130, 131, 132,
+                       133, 134, 221, 222, 227, 252, 253, 254}) {
+    logger.suppressMessage(utl::ODB, id);
+  }
+
+  std::cout << fmt::format(
+      "{:>8} {:>12} {:>10} {:>8}\n", "threads", "ms", "speedup", "nets");
+  double serial_ms = 0;
+  int serial_nets = -1;
+  bool mismatch = false;
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    double best_ms = 0;
+    int nets = 0;
+    for (int i = 0; i < iterations; i++) {
+      const ReadResult result = readDef(&logger, lef_file, def_file, threads);
+      best_ms = (i == 0) ? result.ms : std::min(best_ms, result.ms);
+      nets = result.nets;
+    }
+    if (threads == 1) {
+      serial_ms = best_ms;
+      serial_nets = nets;
+    }
+    mismatch |= nets != serial_nets;
+    std::cout << fmt::format("{:>8} {:>12.1f} {:>10.2f} {:>8}{}\n",
+                             threads,
+                             best_ms,
+                             serial_ms / best_ms,
+                             nets,
+                             (nets != serial_nets) ? " MISMATCH" : "");
+  }
+  return mismatch ? 1 : 0;
+}
@@ -48,6 +48,12 @@ enum class GeneratedSourceType
   kBumps
 };
 
+enum class SolverType
+{
+  kLU,
+  kCG
+};
+
 class PDNSim : public odb::dbBlockCallBackObj
 {
  public:
@@ -66,6 +72,18 @@ class PDNSim : public odb::dbBlockCallBackObj
     float resistance = 0.0;  // Ohms
   };
 
+  struct SolverSettings
+  {
+    SolverType type = SolverType::kLU;
+
+    // Conjugate gradient
+    double tolerance = 1e-10;  // relative residual
+    int max_iterations = 0;    // 0 uses twice the number of unknowns
+
+    // Used to construct the network and by the conjugate gradient solver
+    int threads = 1;
+  };
+
   using IRDropByPoint = std::map<odb::Point, double>;
   using IRDropByLayer = odb::PtrMap<odb::dbTechLayer, IRDropByPoint>;
 
@@ -103,8 +121,11 @@ class PDNSim : public odb::dbBlockCallBackObj
   void setDebugGui(bool enable);
 
   void clearSolvers();
+  void invalidateSolvers();
 
   void setGeneratedSourceSettings(const GeneratedSourceSettings& settings);
+  void setSolverSettings(const SolverSettings& settings);
+  void setThreadCount(int threads);
 
   // from dbBlockCallBackObj
   void inDbPostMoveInst(odb::dbInst*) override;
@@ -148,6 +169,7 @@ class PDNSim : public odb::dbBlockCallBackObj
   bool debug_gui_enabled_ = false;
 
   GeneratedSourceSettings generated_source_settings_;
+  SolverSettings solver_settings_;
 
   odb::PtrMap<odb::dbNet, std::unique_ptr<IRSolver>> solvers_;
   odb::PtrMap<odb::dbNet, std::map<sta::Scene*, double>> user_voltages_;
@@ -28,12 +28,19 @@
 #include "odb/geom_boost.h"
 #include "shape.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 #include "utl/timer.h"
 
 namespace psm {
 
-IRNetwork::IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning)
-    : net_(net), logger_(logger), floorplanning_(floorplanning)
+IRNetwork::IRNetwork(odb::dbNet* net,
+                     utl::Logger* logger,
+                     bool floorplanning,
+                     int threads)
+    : net_(net),
+      logger_(logger),
+      floorplanning_(floorplanning),
+      threads_(std::max(1, threads))
 {
   if (!net_->getSigType().isSupply()) {
     logger_->error(utl::PSM, 87, "{} is not a supply net.", net_->getName());
@@ -106,8 +113,12 @@ void IRNetwork::construct()
 
   reset();
 
-  generateRoutingLayerShapesAndNodes();
-  generateCutLayerNodes();
+  {
+    // Zero workers runs the tasks on the calling thread
+    utl::ThreadPool thread_pool(threads_ > 1 ? threads_ : 0);
+    generateRoutingLayerShapesAndNodes(thread_pool);
+    generateCutLayerNodes(thread_pool);
+  }
 
   if (!hasNodes()) {
     logger_->warn(utl::PSM, 86, "Net {} is empty.", net_->getName());
@@ -165,6 +176,22 @@ void IRNetwork::recoverMemory()
              connections_.capacity());
 }
 
+std::vector<std::pair<std::size_t, std::size_t>> IRNetwork::getChunkRanges(
+    std::size_t count,
+    const utl::ThreadPool& thread_pool) const
+{
+  const std::size_t workers
+      = std::max<std::size_t>(1, thread_pool.threadCount());
+  const std::size_t chunks = std::min(count, kChunksPerThread * workers);
+
+  std::vector<std::pair<std::size_t, std::size_t>> ranges;
+  ranges.reserve(chunks);
+  for (std::size_t i = 0; i < chunks; i++) {
+    ranges.emplace_back(i * count / chunks, (i + 1) * count / chunks);
+  }
+  return ranges;
+}
+
 IRNetwork::Polygon90 IRNetwork::rectToPolygon(const odb::Rect& rect) const
 {
   using Pt = Polygon90::point_type;
@@ -513,7 +540,8 @@ IRNetwork::TerminalTree IRNetwork::getTerminalTree(
   return TerminalTree(terminals.begin(), terminals.end());
 }
 
-void IRNetwork::generateRoutingLayerShapesAndNodes()
+void IRNetwork::generateRoutingLayerShapesAndNodes(
+    utl::ThreadPool& thread_pool)
 {
   using boost::polygon::operators::operator+=;
 
@@ -542,27 +570,27 @@ void IRNetwork::generateRoutingLayerShapesAndNodes()
 
   const TerminalTree terminal_nodes = getTerminalTree(terminals);
 
-  // Simplify shapes
-  std::vector<std::pair<odb::dbTechLayer*, Polygon90>> all_poly_shapes;
-  for (auto& [layer, shapes] : shapes_by_layer) {
-    const utl::DebugScopedTimer layer_timer(
-        logger_,
-        utl::PSM,
-        "timer",
-        1,
-        fmt::format("Convert shapes to polygons shapes on {}: {{}}",
-                    layer->getName()));
-
-    std::vector<Polygon90> shape_polygons;
-    shapes.get_polygons(shape_polygons);
+  // Simplify shapes, each layer is merged independently
+  std::vector<odb::dbTechLayer*> layers;
+  layers.reserve(shapes_by_layer.size());
+  for (const auto& [layer, shapes] : shapes_by_layer) {
+    layers.push_back(layer);
+  }
 
-    debugPrint(logger_,
-               utl::PSM,
-               "timer",
-               1,
-               "Shape reduction on {}: {}",
-               layer->getName(),
-               layer_timer);
+  const utl::Timer reduction_timer;
+  const std::vector<std::vector<Polygon90>> layer_polygons
+      = thread_pool.parallelMap(layers, [&shapes_by_layer](auto* layer) {
+          std::vector<Polygon90> shape_polygons;
+          shapes_by_layer.at(layer).get_polygons(shape_polygons);
+          return shape_polygons;
+        });
+  debugPrint(
+      logger_, utl::PSM, "timer", 1, "Shape reduction: {}", reduction_timer);
+
+  std::vector<std::pair<odb::dbTechLayer*, Polygon90>> all_poly_shapes;
+  for (std::size_t i = 0; i < layers.size(); i++) {
+    odb::dbTechLayer* layer = layers[i];
+    const auto& shape_polygons = layer_polygons[i];
 
     debugPrint(logger_,
                utl::PSM,
@@ -570,7 +598,7 @@ void IRNetwork::generateRoutingLayerShapesAndNodes()
                1,
                "Shapes on {}: {} reduced to {}",
                layer->getName(),
-               shapes.size(),
+               shapes_by_layer.at(layer).size(),
                shape_polygons.size());
 
     for (const auto& shape_poly : shape_polygons) {
@@ -579,18 +607,46 @@ void IRNetwork::generateRoutingLayerShapesAndNodes()
   }
   shapes_by_layer.clear();
 
+  // Decompose the polygons in chunks, the results are concatenated in chunk
+  // order so the nodes and shapes match a serial decomposition.
+  struct PolygonChunk
+  {
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::vector<std::unique_ptr<Shape>> shapes;
+    std::map<Shape*, std::set<Node*>> term_nodes;
+  };
+
   const utl::Timer generate_timer;
+  const std::vector<std::pair<std::size_t, std::size_t>> ranges
+      = getChunkRanges(all_poly_shapes.size(), thread_pool);
+  std::vector<PolygonChunk> chunks = thread_pool.parallelMap(
+      ranges, [this, &all_poly_shapes, &terminal_nodes](const auto& range) {
+        PolygonChunk chunk;
+        for (std::size_t i = range.first; i < range.second; i++) {
+          const auto& [layer, shape_poly] = all_poly_shapes[i];
+          processPolygonToRectangles(layer,
+                                     shape_poly,
+                                     terminal_nodes,
+                                     chunk.shapes,
+                                     chunk.nodes,
+                                     chunk.term_nodes);
+        }
+        return chunk;
+      });
+
   std::vector<std::unique_ptr<Node>> poly_nodes;
   std::vector<std::unique_ptr<Shape>> poly_shapes;
   std::map<Shape*, std::set<Node*>> shape_term_nodes;
-  for (const auto& [layer, shape_poly] : all_poly_shapes) {
-    processPolygonToRectangles(layer,
-                               shape_poly,
-                               terminal_nodes,
-                               poly_shapes,
-                               poly_nodes,
-                               shape_term_nodes);
+  for (auto& chunk : chunks) {
+    std::move(chunk.nodes.begin(),
+              chunk.nodes.end(),
+              std::back_inserter(poly_nodes));
+    std::move(chunk.shapes.begin(),
+              chunk.shapes.end(),
+              std::back_inserter(poly_shapes));
+    shape_term_nodes.merge(chunk.term_nodes);
   }
+  chunks.clear();
 
   debugPrint(
       logger_, utl::PSM, "timer", 1, "Shape generation: {}", generate_timer);
@@ -639,7 +695,8 @@ void IRNetwork::generateCutNodesForSBox(
     bottom = block_via->getBottomLayer();
   }
 
-  const int min_pitch = std::min(min_node_pitch_[bottom], min_node_pitch_[top]);
+  const int min_pitch
+      = std::min(min_node_pitch_.at(bottom), min_node_pitch_.at(top));
   const bool use_single_via
       = floorplanning_ || box->getBox().maxDXDY() < min_pitch;
 
@@ -696,7 +753,7 @@ IRNetwork::NodeTree IRNetwork::getNodeTree(odb::dbTechLayer* layer) const
   return tree;
 }
 
-void IRNetwork::generateCutLayerNodes()
+void IRNetwork::generateCutLayerNodes(utl::ThreadPool& thread_pool)
 {
   const utl::DebugScopedTimer timer(
       logger_, utl::PSM, "timer", 1, "Generate cut nodes and connections: {}");
@@ -713,13 +770,36 @@ void IRNetwork::generateCutLayerNodes()
     }
   }
 
+  struct ViaChunk
+  {
+    std::vector<std::unique_ptr<Node>> nodes;
+    Connections connections;
+  };
+
+  const std::vector<std::pair<std::size_t, std::size_t>> ranges
+      = getChunkRanges(boxes.size(), thread_pool);
+  std::vector<ViaChunk> chunks = thread_pool.parallelMap(
+      ranges, [this, &boxes, use_single_via](const auto& range) {
+        ViaChunk chunk;
+        for (std::size_t i = range.first; i < range.second; i++) {
+          generateCutNodesForSBox(
+              boxes[i], use_single_via, chunk.nodes, chunk.connections);
+        }
+        return chunk;
+      });
+  boxes.clear();
+
   std::vector<std::unique_ptr<Node>> loop_via_nodes;
   Connections loop_via_connections;
-  for (odb::dbSBox* box : boxes) {
-    generateCutNodesForSBox(
-        box, use_single_via, loop_via_nodes, loop_via_connections);
-  }
-  boxes.clear();
+  for (auto& chunk : chunks) {
+    std::move(chunk.nodes.begin(),
+              chunk.nodes.end(),
+              std::back_inserter(loop_via_nodes));
+    std::move(chunk.connections.begin(),
+              chunk.connections.end(),
+              std::back_inserter(loop_via_connections));
+  }
+  chunks.clear();
 
   LayerMap<std::vector<std::unique_ptr<Node>>> via_nodes;
   for (auto& node : loop_via_nodes) {
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "boost/geometry/geometry.hpp"
@@ -20,6 +22,7 @@
 #include "odb/geom.h"
 #include "psm/pdnsim.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace psm {
 
@@ -63,7 +66,10 @@ class IRNetwork
   using Polygon90 = boost::polygon::polygon_90_with_holes_data<int>;
   using Polygon90Set = boost::polygon::polygon_90_set_data<int>;
 
-  IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning);
+  IRNetwork(odb::dbNet* net,
+            utl::Logger* logger,
+            bool floorplanning,
+            int threads);
 
   odb::dbNet* getNet() const { return net_; };
 
@@ -71,6 +77,7 @@ class IRNetwork
 
   bool isFloorplanningOnly() const { return floorplanning_; }
   void setFloorplanning(bool value) { floorplanning_ = value; }
+  void setThreads(int threads) { threads_ = std::max(1, threads); }
 
   void reportStats() const;
 
@@ -127,8 +134,8 @@ class IRNetwork
 
   void sortShapes();
 
-  void generateRoutingLayerShapesAndNodes();
-  void generateCutLayerNodes();
+  void generateRoutingLayerShapesAndNodes(utl::ThreadPool& thread_pool);
+  void generateCutLayerNodes(utl::ThreadPool& thread_pool);
   void generateTopLayerFillerNodes();
   void sortNodes();
   void cleanupNodes();
@@ -178,6 +185,11 @@ class IRNetwork
       const std::vector<TerminalNode*>& terminals) const;
   NodeTree getNodeTree(odb::dbTechLayer* layer) const;
 
+  // Splits [0, count) into contiguous ranges to distribute over the pool
+  std::vector<std::pair<std::size_t, std::size_t>> getChunkRanges(
+      std::size_t count,
+      const utl::ThreadPool& thread_pool) const;
+
   void initMinimumNodePitch();
 
   void recoverMemory();
@@ -190,6 +202,8 @@ class IRNetwork
 
   bool floorplanning_;
 
+  int threads_;
+
   LayerMap<std::vector<std::unique_ptr<Shape>>> shapes_;
   LayerMap<std::vector<std::unique_ptr<Node>>> nodes_;
 
@@ -202,6 +216,7 @@ class IRNetwork
 
   static constexpr int kMinNodePitchMultiplier = 10;
   static constexpr double kMinNodePitchInUm = 10.0;
+  static constexpr std::size_t kChunksPerThread = 4;
 };
 
 }  // namespace psm
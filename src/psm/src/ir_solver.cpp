@@ -42,6 +42,28 @@
 
 namespace psm {
 
+namespace {
+
+// Sets the number of threads used by Eigen and restores the previous value
+// when leaving the scope, including when an error is thrown.
+class EigenThreadsGuard
+{
+ public:
+  explicit EigenThreadsGuard(int threads) : prev_threads_(Eigen::nbThreads())
+  {
+    Eigen::setNbThreads(threads);
+  }
+  ~EigenThreadsGuard() { Eigen::setNbThreads(prev_threads_); }
+
+  EigenThreadsGuard(const EigenThreadsGuard&) = delete;
+  EigenThreadsGuard& operator=(const EigenThreadsGuard&) = delete;
+
+ private:
+  const int prev_threads_;
+};
+
+}  // namespace
+
 IRSolver::IRSolver(
     odb::dbNet* net,
     bool floorplanning,
@@ -50,16 +72,21 @@ IRSolver::IRSolver(
     utl::Logger* logger,
     const UserVoltages& user_voltages,
     const UserPowers& user_powers,
-    const PDNSim::GeneratedSourceSettings& generated_source_settings)
+    const PDNSim::GeneratedSourceSettings& generated_source_settings,
+    const PDNSim::SolverSettings& solver_settings)
     : net_(net),
       logger_(logger),
       estimate_parasitics_(estimate_parasitics),
       sta_(sta),
-      network_(new IRNetwork(net_, logger_, floorplanning)),
+      network_(new IRNetwork(net_,
+                             logger_,
+                             floorplanning,
+                             solver_settings.threads)),
       gui_(nullptr),
       user_voltages_(user_voltages),
       user_powers_(user_powers),
-      generated_source_settings_(generated_source_settings)
+      generated_source_settings_(generated_source_settings),
+      solver_settings_(solver_settings)
 {
 }
 
@@ -75,6 +102,51 @@ void IRSolver::enableGui(bool enable)
   }
 }
 
+void IRSolver::invalidateNetwork()
+{
+  if (!network_valid_) {
+    return;
+  }
+  network_valid_ = false;
+
+  if (solver_settings_.type == SolverType::kCG) {
+    for (const auto& [corner, voltages] : voltages_) {
+      auto& warm_start = warm_start_voltages_[corner];
+      warm_start.clear();
+      for (const auto& [node, voltage] : voltages) {
+        warm_start[node->getLayer()][node->getPoint()] = voltage;
+      }
+    }
+  }
+
+  voltages_.clear();
+  currents_.clear();
+  solution_voltages_.clear();
+  solution_power_.clear();
+  solver_state_.clear();
+  connected_.reset();
+  if (gui_) {
+    // The shapes and nodes it draws go away when the network is rebuilt,
+    // so drop them now and repopulate in updateNetwork.
+    gui_->reset();
+  }
+}
+
+void IRSolver::updateNetwork()
+{
+  if (network_valid_) {
+    return;
+  }
+
+  network_->setThreads(solver_settings_.threads);
+  network_->construct();
+  network_valid_ = true;
+
+  if (gui_) {
+    gui_->populate();
+  }
+}
+
 odb::dbBlock* IRSolver::getBlock() const
 {
   return net_->getBlock();
@@ -911,17 +983,14 @@ std::map<Node*, std::size_t> IRSolver::assignNodeIDs(const SourceNodes& nodes,
   return assignNodeIDs(node_set, start);
 }
 
-void IRSolver::buildCondMatrixAndVoltages(
-    bool is_ground,
+void IRSolver::buildCondMatrix(
     const std::map<Node*, Connection::ConnectionSet>& node_connections,
-    const ValueNodeMap<Current>& currents,
     const Connection::ConnectionMap<Connection::Conductance>& conductance,
     const std::map<Node*, std::size_t>& node_index,
-    Eigen::SparseMatrix<Connection::Conductance>& g_matrix,
-    Eigen::VectorXd& j_vector) const
+    Eigen::SparseMatrix<Connection::Conductance>& g_matrix) const
 {
   const utl::DebugScopedTimer timer(
-      logger_, utl::PSM, "timer", 1, "Build G and J: {}");
+      logger_, utl::PSM, "timer", 1, "Build G: {}");
 
   const bool print_progress = logger_->debugCheck(utl::PSM, "progress", 1);
   std::size_t count = 0;
@@ -929,13 +998,6 @@ void IRSolver::buildCondMatrixAndVoltages(
   for (const auto& [node, connections] : node_connections) {
     const std::size_t node_idx = node_index.at(node);
 
-    auto find_node = currents.find(node);
-    if (find_node == currents.end()) {
-      j_vector[node_idx] = 0;
-    } else {
-      j_vector[node_idx] = find_node->second;
-    }
-
     Connection::Conductance node_cond = 0.0;
     for (auto* conn : connections) {
       Node* other = conn->getOtherNode(node);
@@ -954,30 +1016,20 @@ void IRSolver::buildCondMatrixAndVoltages(
     count++;
   }
   g_matrix.setFromTriplets(cond_values.begin(), cond_values.end());
-  if (!is_ground) {
-    for (auto& j : j_vector) {
-      j = -j;
-    }
-  }
   cond_values.clear();
 }
 
-void IRSolver::addSourcesToMatrixAndVoltages(
-    Voltage src_voltage,
+void IRSolver::addSourcesToMatrix(
     const SourceNodes& sources,
     const std::map<Node*, std::size_t>& node_index,
-    Eigen::SparseMatrix<Connection::Conductance>& g_matrix,
-    Eigen::VectorXd& j_vector) const
+    Eigen::SparseMatrix<Connection::Conductance>& g_matrix) const
 {
   // Attach sources as current sources through a 1 ohm resistor
-  const Connection::Resistance src_res = 1.0;
-  const Connection::Conductance src_cond = 1.0 / src_res;
+  const Connection::Conductance src_cond = 1.0 / kSourceResistance;
 
   for (const auto& src_node : sources) {
     const std::size_t idx = node_index.at(src_node.get());
 
-    j_vector[idx] = src_voltage / src_res;
-
     Node* real_node = src_node->getSource();
 
     const std::size_t real_node_idx = node_index.at(real_node);
@@ -995,57 +1047,63 @@ void IRSolver::addSourcesToMatrixAndVoltages(
   }
 }
 
-void IRSolver::solve(sta::Scene* corner,
-                     GeneratedSourceType source_type,
-                     const std::string& source_file)
+void IRSolver::buildCurrentVector(bool is_ground,
+                                  Voltage src_voltage,
+                                  const ValueNodeMap<Current>& currents,
+                                  const SolverState& state,
+                                  Eigen::VectorXd& j_vector) const
 {
-  const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Build J: {}");
 
-  if (network_->isFloorplanningOnly()) {
-    network_->setFloorplanning(false);
-    network_->construct();
+  j_vector = Eigen::VectorXd::Zero(state.g_matrix.rows());
+  for (const auto& [node, node_idx] : state.node_index) {
+    auto find_node = currents.find(node);
+    if (find_node == currents.end()) {
+      continue;
+    }
+    if (is_ground) {
+      j_vector[node_idx] = find_node->second;
+    } else {
+      j_vector[node_idx] = -find_node->second;
+    }
   }
 
-  if (!network_->hasNodes()) {
-    voltages_.erase(corner);
-    currents_.erase(corner);
-    solution_voltages_.erase(corner);
-    solution_power_.erase(corner);
-    return;
+  for (const auto& src_node : state.src_nodes) {
+    j_vector[state.node_index.at(src_node.get())]
+        = src_voltage / kSourceResistance;
   }
+}
 
-  assertResistanceMap(corner);
-
-  // Reset
-  auto& voltages = voltages_[corner];
-  auto& currents = currents_[corner];
-
-  voltages.clear();
-  currents.clear();
-
-  // Build source map
-  SourceNodes real_src_nodes;
-  Voltage src_voltage
-      = generateSourceNodes(source_type, source_file, corner, real_src_nodes);
+void IRSolver::buildSolverState(sta::Scene* corner,
+                                std::vector<Node*> source_key,
+                                Connection::ResistanceMap resistance,
+                                SourceNodes& real_src_nodes,
+                                SolverState& state) const
+{
+  state = SolverState();
+  state.source_key = std::move(source_key);
+  state.resistance = std::move(resistance);
+  state.source_resistance = generated_source_settings_.resistance;
 
-  SourceNodes src_nodes;
-  Connections src_conns;
   // If resistance is set, add connection from source nodes to new source and
   // connect
   if (generated_source_settings_.resistance > 0) {
-    src_nodes.reserve(real_src_nodes.size());
-    src_conns.reserve(real_src_nodes.size());
+    state.src_nodes.reserve(real_src_nodes.size());
+    state.src_conns.reserve(real_src_nodes.size());
     for (const auto& real_src_node : real_src_nodes) {
-      src_conns.push_back(std::make_unique<FixedResistanceConnection>(
+      state.src_conns.push_back(std::make_unique<FixedResistanceConnection>(
           real_src_node->getSource(),
           real_src_node.get(),
           generated_source_settings_.resistance));
-      src_nodes.push_back(std::make_unique<SourceNode>(real_src_node.get()));
+      state.src_nodes.push_back(
+          std::make_unique<SourceNode>(real_src_node.get()));
     }
+    state.real_src_nodes = std::move(real_src_nodes);
   } else {
-    src_nodes = std::move(real_src_nodes);
-    real_src_nodes.clear();
+    state.src_nodes = std::move(real_src_nodes);
   }
+  real_src_nodes.clear();
 
   // Build conductance map
   Connection::ConnectionMap<Connection::Conductance> conductance
@@ -1069,8 +1127,9 @@ void IRSolver::solve(sta::Scene* corner,
   }
 
   // Add source conductance
-  if (!src_conns.empty()) {
-    const auto src_conductance = generateConductanceMap(corner, src_conns);
+  if (!state.src_conns.empty()) {
+    const auto src_conductance
+        = generateConductanceMap(corner, state.src_conns);
     for (const auto& [conn, cond] : src_conductance) {
       conductance[conn] = cond;
     }
@@ -1079,21 +1138,23 @@ void IRSolver::solve(sta::Scene* corner,
     }
   }
 
-  const Power total_power = buildNodeCurrentMap(corner, currents);
-
-  // Solve
   // create vector of nodes
-  std::map<Node*, std::size_t> node_index = assignNodeIDs(all_nodes);
-  const std::map<Node*, std::size_t> real_node_index = node_index;
+  state.node_index = assignNodeIDs(all_nodes);
+  state.real_node_index = state.node_index;
   for (const auto& [node, id] :
-       assignNodeIDs(real_src_nodes, node_index.size())) {
-    node_index[node] = id;
+       assignNodeIDs(state.real_src_nodes, state.node_index.size())) {
+    state.node_index[node] = id;
   }
-  for (const auto& [node, id] : assignNodeIDs(src_nodes, node_index.size())) {
-    node_index[node] = id;
+  for (const auto& [node, id] :
+       assignNodeIDs(state.src_nodes, state.node_index.size())) {
+    state.node_index[node] = id;
   }
 
-  const std::size_t num_nodes = node_index.size();
+  const std::size_t num_nodes = state.node_index.size();
+  state.index_node.resize(num_nodes);
+  for (const auto& [node, id] : state.node_index) {
+    state.index_node[id] = node;
+  }
 
   debugPrint(logger_,
              utl::PSM,
@@ -1103,49 +1164,85 @@ void IRSolver::solve(sta::Scene* corner,
              all_nodes.size());
   debugPrint(logger_, utl::PSM, "stats", 1, "Nodes in matrix: {}", num_nodes);
 
-  // create sparse matrix and vector
-  Eigen::SparseMatrix<Connection::Conductance> g_matrix(num_nodes, num_nodes);
-  Eigen::VectorXd j_vector(num_nodes);
-
-  // Build G and J
-  buildCondMatrixAndVoltages(src_voltage == 0.0,
-                             node_connections,
-                             currents,
-                             conductance,
-                             node_index,
-                             g_matrix,
-                             j_vector);
-  addSourcesToMatrixAndVoltages(
-      src_voltage, src_nodes, node_index, g_matrix, j_vector);
-
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(g_matrix);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // decomposition failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(g_matrix, "G");
-      dumpVector(j_vector, "J");
-    }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
+  // Build G
+  state.g_matrix.resize(num_nodes, num_nodes);
+  buildCondMatrix(
+      node_connections, conductance, state.node_index, state.g_matrix);
+  addSourcesToMatrix(state.src_nodes, state.node_index, state.g_matrix);
+}
+
+void IRSolver::solve(sta::Scene* corner,
+                     GeneratedSourceType source_type,
+                     const std::string& source_file)
+{
+  const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
+
+  if (network_->isFloorplanningOnly()) {
+    network_->setFloorplanning(false);
+    network_->setThreads(solver_settings_.threads);
+    network_->construct();
+    solver_state_.clear();
   }
 
-  debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd v_vector = eigen_solver.solve(j_vector);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // solving failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(g_matrix, "G");
-      dumpVector(j_vector, "J");
-    }
-    logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
+  if (!network_->hasNodes()) {
+    voltages_.erase(corner);
+    currents_.erase(corner);
+    solution_voltages_.erase(corner);
+    solution_power_.erase(corner);
+    solver_state_.erase(corner);
+    return;
+  }
+
+  assertResistanceMap(corner);
+
+  // Reset
+  auto& voltages = voltages_[corner];
+  auto& currents = currents_[corner];
+
+  voltages.clear();
+  currents.clear();
+
+  // Build source map
+  SourceNodes real_src_nodes;
+  const Voltage src_voltage
+      = generateSourceNodes(source_type, source_file, corner, real_src_nodes);
+
+  // The G matrix only depends on the network, the layer resistances and
+  // where the sources attach, so it can be reused when only the currents or
+  // voltages changed.
+  std::vector<Node*> source_key;
+  source_key.reserve(real_src_nodes.size());
+  for (const auto& real_src_node : real_src_nodes) {
+    source_key.push_back(real_src_node->getSource());
+  }
+  Connection::ResistanceMap resistance = getResistanceMap(corner);
+
+  auto& state = solver_state_[corner];
+  if (state.g_matrix.rows() == 0 || state.source_key != source_key
+      || state.source_resistance != generated_source_settings_.resistance
+      || state.resistance != resistance) {
+    buildSolverState(corner,
+                     std::move(source_key),
+                     std::move(resistance),
+                     real_src_nodes,
+                     state);
+  } else {
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Reusing G matrix from previous solve");
+  }
+
+  const Power total_power = buildNodeCurrentMap(corner, currents);
+
+  // Build J
+  Eigen::VectorXd j_vector;
+  buildCurrentVector(
+      src_voltage == 0.0, src_voltage, currents, state, j_vector);
+
+  Eigen::VectorXd v_vector;
+  if (solver_settings_.type == SolverType::kCG) {
+    v_vector = solveCG(corner, src_voltage, state, j_vector);
+  } else {
+    v_vector = solveLU(state, j_vector);
   }
   debugPrint(logger_,
              utl::PSM,
@@ -1154,18 +1251,253 @@ void IRSolver::solve(sta::Scene* corner,
              "Solving system of equations GV=J complete");
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    network_->dumpNodes(node_index);
-    dumpMatrix(g_matrix, "G");
+    network_->dumpNodes(state.node_index);
+    dumpMatrix(state.g_matrix, "G");
     dumpVector(j_vector, "J");
     dumpVector(v_vector, "V");
   }
-  for (const auto& [node, node_idx] : real_node_index) {
+  for (const auto& [node, node_idx] : state.real_node_index) {
     voltages[node] = v_vector[node_idx];
   }
+  warm_start_voltages_.erase(corner);
   solution_voltages_[corner] = src_voltage;
   solution_power_[corner] = total_power;
 }
 
+Eigen::VectorXd IRSolver::solveLU(SolverState& state,
+                                  const Eigen::VectorXd& j_vector) const
+{
+  if (state.lu == nullptr) {
+    state.cg = nullptr;
+    state.reduced_matrix = Eigen::SparseMatrix<Connection::Conductance>();
+
+    state.lu = std::make_unique<LUSolver>();
+
+    debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+    state.lu->compute(state.g_matrix);
+    if (state.lu->info() != Eigen::ComputationInfo::Success) {
+      // decomposition failed
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        network_->dumpNodes(state.node_index);
+        dumpMatrix(state.g_matrix, "G");
+        dumpVector(j_vector, "J");
+      }
+      logger_->error(utl::PSM,
+                     10,
+                     "LU factorization of the G Matrix failed. SparseLU "
+                     "solver message: {}.",
+                     state.lu->lastErrorMessage());
+    }
+  } else {
+    debugPrint(logger_,
+               utl::PSM,
+               "solve",
+               1,
+               "Reusing factorization of the G matrix");
+  }
+
+  debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
+  Eigen::VectorXd v_vector = state.lu->solve(j_vector);
+  if (state.lu->info() != Eigen::ComputationInfo::Success) {
+    // solving failed
+    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+      network_->dumpNodes(state.node_index);
+      dumpMatrix(state.g_matrix, "G");
+      dumpVector(j_vector, "J");
+    }
+    logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
+  }
+
+  return v_vector;
+}
+
+void IRSolver::prepareCG(SolverState& state) const
+{
+  // The source branches make G indefinite, so the nodes driven by a source
+  // are eliminated as fixed voltages, which leaves a symmetric positive
+  // definite system over the remaining nodes.
+  const Eigen::Index num_nodes = state.g_matrix.rows();
+  const Eigen::Index first_src_idx
+      = num_nodes - static_cast<Eigen::Index>(state.src_nodes.size());
+
+  std::vector<bool> fixed(num_nodes, false);
+  for (const auto& src_node : state.src_nodes) {
+    fixed[state.node_index.at(src_node->getSource())] = true;
+  }
+
+  state.reduced_index.assign(num_nodes, -1);
+  Eigen::Index num_free = 0;
+  for (Eigen::Index idx = 0; idx < first_src_idx; idx++) {
+    if (!fixed[idx]) {
+      state.reduced_index[idx] = num_free++;
+    }
+  }
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Building reduced G matrix with {} unknowns",
+             num_free);
+
+  state.fixed_conductance = Eigen::VectorXd::Zero(num_free);
+  std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
+  cond_values.reserve(state.g_matrix.nonZeros());
+  for (Eigen::Index col = 0; col < first_src_idx; col++) {
+    for (Eigen::SparseMatrix<Connection::Conductance>::InnerIterator it(
+             state.g_matrix, col);
+         it;
+         ++it) {
+      const Eigen::Index row = it.row();
+      if (row >= first_src_idx || state.reduced_index[row] < 0) {
+        continue;
+      }
+      if (fixed[col]) {
+        state.fixed_conductance[state.reduced_index[row]] += it.value();
+      } else {
+        cond_values.emplace_back(
+            state.reduced_index[row], state.reduced_index[col], it.value());
+      }
+    }
+  }
+  state.reduced_matrix.resize(num_free, num_free);
+  state.reduced_matrix.setFromTriplets(cond_values.begin(), cond_values.end());
+  cond_values.clear();
+  cond_values.shrink_to_fit();
+
+  state.cg = std::make_unique<CGSolver>();
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Computing incomplete Cholesky preconditioner");
+  state.cg->compute(state.reduced_matrix);
+  if (state.cg->info() != Eigen::ComputationInfo::Success) {
+    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+      network_->dumpNodes(state.node_index);
+      dumpMatrix(state.g_matrix, "G");
+    }
+    logger_->error(utl::PSM,
+                   94,
+                   "Incomplete Cholesky preconditioning of the G Matrix "
+                   "failed.");
+  }
+}
+
+Eigen::VectorXd IRSolver::solveCG(sta::Scene* corner,
+                                  Voltage src_voltage,
+                                  SolverState& state,
+                                  const Eigen::VectorXd& j_vector) const
+{
+  const EigenThreadsGuard threads_guard(solver_settings_.threads);
+
+  if (state.cg == nullptr) {
+    state.lu = nullptr;
+    prepareCG(state);
+  } else {
+    debugPrint(logger_,
+               utl::PSM,
+               "solve",
+               1,
+               "Reusing preconditioner of the G matrix");
+  }
+
+  const Eigen::Index num_nodes = state.g_matrix.rows();
+  const Eigen::Index num_free = state.reduced_matrix.rows();
+
+  Eigen::VectorXd b_vector = -src_voltage * state.fixed_conductance;
+  for (Eigen::Index idx = 0; idx < num_nodes; idx++) {
+    const Eigen::Index reduced_idx = state.reduced_index[idx];
+    if (reduced_idx >= 0) {
+      b_vector[reduced_idx] += j_vector[idx];
+    }
+  }
+
+  // Start from the previous solution of this system, or from the voltages
+  // of the network before it was last modified.
+  Eigen::VectorXd guess;
+  if (state.x_vector.size() == num_free) {
+    guess = state.x_vector;
+  } else {
+    guess = Eigen::VectorXd::Constant(num_free, src_voltage);
+    auto find_warm_start = warm_start_voltages_.find(corner);
+    if (find_warm_start != warm_start_voltages_.end()) {
+      const VoltageByLayer& warm_start = find_warm_start->second;
+      std::size_t warm_nodes = 0;
+      for (Eigen::Index idx = 0; idx < num_nodes; idx++) {
+        const Eigen::Index reduced_idx = state.reduced_index[idx];
+        if (reduced_idx < 0) {
+          continue;
+        }
+        const Node* node = state.index_node[idx];
+        auto find_layer = warm_start.find(node->getLayer());
+        if (find_layer == warm_start.end()) {
+          continue;
+        }
+        auto find_pt = find_layer->second.find(node->getPoint());
+        if (find_pt == find_layer->second.end()) {
+          continue;
+        }
+        guess[reduced_idx] = find_pt->second;
+        warm_nodes++;
+      }
+      debugPrint(logger_,
+                 utl::PSM,
+                 "solve",
+                 1,
+                 "Warm starting {} of {} nodes from previous solution",
+                 warm_nodes,
+                 num_free);
+    }
+  }
+
+  state.cg->setTolerance(solver_settings_.tolerance);
+  if (solver_settings_.max_iterations > 0) {
+    state.cg->setMaxIterations(solver_settings_.max_iterations);
+  } else {
+    state.cg->setMaxIterations(2 * num_free);
+  }
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Solving system of equations GV=J with conjugate gradient");
+  state.x_vector = state.cg->solveWithGuess(b_vector, guess);
+
+  if (state.cg->info() != Eigen::ComputationInfo::Success) {
+    logger_->warn(utl::PSM,
+                  95,
+                  "Conjugate gradient solver did not converge after {} "
+                  "iterations, estimated error {:3.2e} (tolerance {:3.2e}).",
+                  state.cg->iterations(),
+                  state.cg->error(),
+                  state.cg->tolerance());
+  } else {
+    logger_->info(utl::PSM,
+                  96,
+                  "Conjugate gradient solver converged after {} iterations, "
+                  "estimated error {:3.2e} (tolerance {:3.2e}).",
+                  state.cg->iterations(),
+                  state.cg->error(),
+                  state.cg->tolerance());
+  }
+
+  Eigen::VectorXd v_vector = Eigen::VectorXd::Zero(num_nodes);
+  for (Eigen::Index idx = 0; idx < num_nodes; idx++) {
+    const Eigen::Index reduced_idx = state.reduced_index[idx];
+    if (reduced_idx >= 0) {
+      v_vector[idx] = state.x_vector[reduced_idx];
+    }
+  }
+  for (const auto& src_node : state.src_nodes) {
+    v_vector[state.node_index.at(src_node->getSource())] = src_voltage;
+  }
+
+  return v_vector;
+}
+
 odb::PtrMap<odb::dbInst, IRSolver::Power> IRSolver::getInstancePower(
     sta::Scene* corner) const
 {
@@ -75,12 +75,19 @@ class IRSolver
            utl::Logger* logger,
            const UserVoltages& user_voltages,
            const UserPowers& user_powers,
-           const PDNSim::GeneratedSourceSettings& generated_source_settings);
+           const PDNSim::GeneratedSourceSettings& generated_source_settings,
+           const PDNSim::SolverSettings& solver_settings);
 
   odb::dbNet* getNet() const { return net_; };
 
   bool check(bool check_bterms);
 
+  // Marks the network as stale after an edit to the power grid or placement.
+  // The network is rebuilt by updateNetwork() and the previous voltages are
+  // kept to warm start the next iterative solve.
+  void invalidateNetwork();
+  void updateNetwork();
+
   void solve(sta::Scene* corner,
              GeneratedSourceType source_type,
              const std::string& source_file);
@@ -130,6 +137,45 @@ class IRSolver
  private:
   template <typename T>
   using ValueNodeMap = std::map<const Node*, T>;
+  using VoltageByLayer
+      = odb::PtrMap<odb::dbTechLayer, std::map<odb::Point, Voltage>>;
+  using LUSolver
+      = Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>;
+  // Using both triangles allows the matrix-vector products to run in parallel
+  using CGSolver
+      = Eigen::ConjugateGradient<Eigen::SparseMatrix<Connection::Conductance>,
+                                 Eigen::Lower | Eigen::Upper,
+                                 Eigen::IncompleteCholesky<
+                                     Connection::Conductance>>;
+
+  // G matrix and its factorization for a corner, kept between solves as long
+  // as the network and the source nodes are unchanged.
+  struct SolverState
+  {
+    std::vector<Node*> source_key;
+    float source_resistance = 0.0;
+    // Layer resistances G was built with, which change with set_layer_rc
+    Connection::ResistanceMap resistance;
+
+    SourceNodes real_src_nodes;
+    SourceNodes src_nodes;
+    Connections src_conns;
+
+    std::map<Node*, std::size_t> node_index;
+    std::map<Node*, std::size_t> real_node_index;
+    std::vector<Node*> index_node;
+    Eigen::SparseMatrix<Connection::Conductance> g_matrix;
+
+    // LU
+    std::unique_ptr<LUSolver> lu;
+
+    // CG: source driven nodes are eliminated as fixed voltages
+    std::vector<Eigen::Index> reduced_index;
+    Eigen::SparseMatrix<Connection::Conductance> reduced_matrix;
+    Eigen::VectorXd fixed_conductance;
+    std::unique_ptr<CGSolver> cg;
+    Eigen::VectorXd x_vector;
+  };
 
   odb::dbBlock* getBlock() const;
   odb::dbTech* getTech() const;
@@ -173,20 +219,33 @@ class IRSolver
                                              std::size_t start = 0) const;
   std::map<Node*, std::size_t> assignNodeIDs(const SourceNodes& nodes,
                                              std::size_t start = 0) const;
-  void buildCondMatrixAndVoltages(
-      bool is_ground,
+  void buildSolverState(sta::Scene* corner,
+                        std::vector<Node*> source_key,
+                        Connection::ResistanceMap resistance,
+                        SourceNodes& real_src_nodes,
+                        SolverState& state) const;
+  void buildCondMatrix(
       const std::map<Node*, Connection::ConnectionSet>& node_connections,
-      const ValueNodeMap<Current>& currents,
       const Connection::ConnectionMap<Connection::Conductance>& conductance,
       const std::map<Node*, std::size_t>& node_index,
-      Eigen::SparseMatrix<Connection::Conductance>& g_matrix,
-      Eigen::VectorXd& j_vector) const;
-  void addSourcesToMatrixAndVoltages(
-      Voltage src_voltage,
+      Eigen::SparseMatrix<Connection::Conductance>& g_matrix) const;
+  void addSourcesToMatrix(
       const SourceNodes& sources,
       const std::map<Node*, std::size_t>& node_index,
-      Eigen::SparseMatrix<Connection::Conductance>& g_matrix,
-      Eigen::VectorXd& j_vector) const;
+      Eigen::SparseMatrix<Connection::Conductance>& g_matrix) const;
+  void buildCurrentVector(bool is_ground,
+                          Voltage src_voltage,
+                          const ValueNodeMap<Current>& currents,
+                          const SolverState& state,
+                          Eigen::VectorXd& j_vector) const;
+
+  Eigen::VectorXd solveLU(SolverState& state,
+                          const Eigen::VectorXd& j_vector) const;
+  void prepareCG(SolverState& state) const;
+  Eigen::VectorXd solveCG(sta::Scene* corner,
+                          Voltage src_voltage,
+                          SolverState& state,
+                          const Eigen::VectorXd& j_vector) const;
 
   std::string getMetricKey(const std::string& key, sta::Scene* corner) const;
 
@@ -213,13 +272,19 @@ class IRSolver
   std::map<sta::Scene*, Power> solution_power_;
 
   const PDNSim::GeneratedSourceSettings& generated_source_settings_;
+  const PDNSim::SolverSettings& solver_settings_;
 
   std::optional<bool> connected_;
 
   std::map<sta::Scene*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Scene*, ValueNodeMap<Current>> currents_;
 
+  bool network_valid_ = true;
+  std::map<sta::Scene*, SolverState> solver_state_;
+  std::map<sta::Scene*, VoltageByLayer> warm_start_voltages_;
+
   static constexpr Current kSpiceFileMinCurrent = 1e-18;
+  static constexpr Connection::Resistance kSourceResistance = 1.0;
 };
 
 }  // namespace psm
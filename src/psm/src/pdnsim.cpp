@@ -162,8 +162,11 @@ psm::IRSolver* PDNSim::getIRSolver(odb::dbNet* net, bool floorplanning)
                                         logger_,
                                         user_voltages_,
                                         user_powers_,
-                                        generated_source_settings_);
+                                        generated_source_settings_,
+                                        solver_settings_);
     addOwner(net->getBlock());
+  } else {
+    solver->updateNetwork();
   }
 
   return solver.get();
@@ -214,14 +217,31 @@ void PDNSim::setGeneratedSourceSettings(const GeneratedSourceSettings& settings)
   }
 }
 
+void PDNSim::setSolverSettings(const SolverSettings& settings)
+{
+  solver_settings_ = settings;
+}
+
+void PDNSim::setThreadCount(int threads)
+{
+  solver_settings_.threads = std::max(1, threads);
+}
+
 void PDNSim::clearSolvers()
 {
   solvers_.clear();
 }
 
+void PDNSim::invalidateSolvers()
+{
+  for (const auto& [net, solver] : solvers_) {
+    solver->invalidateNetwork();
+  }
+}
+
 void PDNSim::inDbPostMoveInst(odb::dbInst*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbNetDestroy(odb::dbNet*)
@@ -231,47 +251,47 @@ void PDNSim::inDbNetDestroy(odb::dbNet*)
 
 void PDNSim::inDbBTermPostConnect(odb::dbBTerm*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbBTermPostDisConnect(odb::dbBTerm*, odb::dbNet*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbBPinCreate(odb::dbBPin*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbBPinAddBox(odb::dbBox*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbBPinRemoveBox(odb::dbBox*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbBPinDestroy(odb::dbBPin*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbSWireAddSBox(odb::dbSBox*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbSWireRemoveSBox(odb::dbSBox*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 void PDNSim::inDbSWirePostDestroySBoxes(odb::dbSWire*)
 {
-  clearSolvers();
+  invalidateSolvers();
 }
 
 // Functions of decap cells
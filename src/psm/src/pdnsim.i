@@ -44,6 +44,17 @@ using sta::Scene;
   }
 }
 
+%typemap(in) psm::SolverType {
+  Tcl_Size length;
+  const char *arg = Tcl_GetStringFromObj($input, &length);
+
+  if (strcmp(arg, "CG") == 0) {
+    $1 = psm::SolverType::kCG;
+  } else {
+    $1 = psm::SolverType::kLU;
+  }
+}
+
 %inline %{
 
 
@@ -58,6 +69,7 @@ void
 analyze_power_grid_cmd(odb::dbNet* net, Scene* corner, psm::GeneratedSourceType type, const char* error_file, bool reuse_solution, bool enable_em, const char* em_file, const char* voltage_file, const char* voltage_source_file)
 {
   PDNSim* pdnsim = getPDNSim();
+  pdnsim->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
   pdnsim->analyzePowerGrid(net, corner, type, voltage_file, reuse_solution, enable_em, em_file, error_file, voltage_source_file);
 }
 
@@ -79,6 +91,7 @@ bool
 check_connectivity_cmd(odb::dbNet* net, bool floorplanning, const char* error_file, bool dont_require_bterm)
 {
   PDNSim* pdnsim = getPDNSim();
+  pdnsim->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
   return pdnsim->checkConnectivity(net, floorplanning, error_file, !dont_require_bterm);
 }
 
@@ -86,6 +99,7 @@ void
 write_spice_file_cmd(odb::dbNet* net, Scene* corner, psm::GeneratedSourceType type, const char* file, const char* voltage_source_file)
 {
   PDNSim* pdnsim = getPDNSim();
+  pdnsim->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
   return pdnsim->writeSpiceNetwork(net, corner, type, file, voltage_source_file);
 }
 
@@ -115,6 +129,22 @@ void set_source_settings(int bump_dx, int bump_dy, int bump_size, int bump_inter
   pdnsim->setGeneratedSourceSettings(settings);
 }
 
+void set_solver_settings(psm::SolverType type, double tolerance, int max_iterations)
+{
+  PDNSim::SolverSettings settings;
+  settings.type = type;
+  if (tolerance > 0) {
+    settings.tolerance = tolerance;
+  }
+  if (max_iterations > 0) {
+    settings.max_iterations = max_iterations;
+  }
+  settings.threads = ord::OpenRoad::openRoad()->getThreadCount();
+
+  PDNSim* pdnsim = getPDNSim();
+  pdnsim->setSolverSettings(settings);
+}
+
 void
 set_inst_power(odb::dbInst* inst, Scene* corner, float power)
 {
@@ -271,6 +271,40 @@ proc set_pdnsim_source_settings { args } {
   psm::set_source_settings $dx $dy $size $interval $track_pitch $resistance
 }
 
+sta::define_cmd_args "set_pdnsim_solver_settings" {
+  [-solver LU|CG]
+  [-tolerance tolerance]
+  [-max_iterations iterations]
+}
+
+proc set_pdnsim_solver_settings { args } {
+  sta::parse_key_args "set_pdnsim_solver_settings" args \
+    keys {-solver -tolerance -max_iterations} \
+    flags {}
+
+  set solver "LU"
+  if { [info exists keys(-solver)] } {
+    set solver [string toupper $keys(-solver)]
+    if { [lsearch -exact {LU CG} $solver] == -1 } {
+      utl::error PSM 97 "-solver must be LU or CG."
+    }
+  }
+
+  set tolerance 0
+  if { [info exists keys(-tolerance)] } {
+    set tolerance $keys(-tolerance)
+    sta::check_positive_float "-tolerance" $tolerance
+  }
+
+  set max_iterations 0
+  if { [info exists keys(-max_iterations)] } {
+    set max_iterations $keys(-max_iterations)
+    sta::check_positive_integer "-max_iterations" $max_iterations
+  }
+
+  psm::set_solver_settings $solver $tolerance $max_iterations
+}
+
 namespace eval psm {
 proc find_net { net_name } {
   set net [[ord::get_db_block] findNet $net_name]
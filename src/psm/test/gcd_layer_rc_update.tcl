@@ -0,0 +1,39 @@
+# Check that a new set_layer_rc is used by the next analyze_power_grid
+source helpers.tcl
+source "psm-helpers.tcl"
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+set voltage_file [make_result_file gcd_layer_rc_update-voltage.rpt]
+set rc_voltage_file [make_result_file gcd_layer_rc_update-rc-voltage.rpt]
+set fresh_voltage_file [make_result_file gcd_layer_rc_update-fresh-voltage.rpt]
+
+check_power_grid -net VDD -dont_require_terminals
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file -net VDD
+
+diff_files $voltage_file gcd_test_vdd-voltage.rptok
+
+# Reuses the network of the previous solve with the new metal1 resistance
+set_layer_rc -layer metal1 -resistance 5.432e-03 -capacitance 8.494e-02
+tee -quiet -variable report {
+  analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $rc_voltage_file \
+    -net VDD
+}
+
+check "voltages follow set_layer_rc" {
+  expr { [max_voltage_diff $voltage_file $rc_voltage_file] > 1e-6 }
+} 1
+
+# Destroying a net drops the solvers so this solve starts from scratch
+odb::dbNet_destroy [odb::dbNet_create [ord::get_db_block] dummy]
+tee -quiet -variable report {
+  analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $fresh_voltage_file \
+    -net VDD
+}
+
+diff_files $rc_voltage_file $fresh_voltage_file
+
+exit_summary
@@ -0,0 +1,27 @@
+# Solve gcd VDD with the conjugate gradient solver and check the voltages
+# against the LU solution of gcd_test_vdd
+source helpers.tcl
+source "psm-helpers.tcl"
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+catch { set_pdnsim_solver_settings -solver QR } err
+puts $err
+
+set_pdnsim_solver_settings -solver CG -tolerance 1e-12
+# The iteration count depends on the Eigen version
+suppress_message PSM 96
+
+set voltage_file [make_result_file gcd_test_vdd_cg-voltage.rpt]
+
+check_power_grid -net VDD -dont_require_terminals
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file -net VDD
+
+check "CG voltages match LU" {
+  expr { [max_voltage_diff $voltage_file gcd_test_vdd-voltage.rptok] < 2e-6 }
+} 1
+
+exit_summary
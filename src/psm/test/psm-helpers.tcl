@@ -0,0 +1,19 @@
+# Helper functions common to multiple psm regressions.
+
+# Largest difference in the voltage column of two voltage files.
+proc max_voltage_diff { file1 file2 } {
+  set stream1 [open $file1 r]
+  set stream2 [open $file2 r]
+  # skip the header
+  gets $stream1
+  gets $stream2
+  set max_diff 0.0
+  while { [gets $stream1 line1] >= 0 && [gets $stream2 line2] >= 0 } {
+    set diff [expr { abs([lindex [split $line1 ","] end] \
+      - [lindex [split $line2 ","] end]) }]
+    set max_diff [expr { max($max_diff, $diff) }]
+  }
+  close $stream1
+  close $stream2
+  return $max_diff
+}
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <functional>
 #include <string>
 
 #include "odb/db.h"
@@ -15,6 +16,10 @@
 #include "rcx/grids.h"
 #include "rcx/util.h"
 
+namespace utl {
+class ThreadPool;
+}
+
 namespace rcx {
 
 // Configuration settings for coupling flow
@@ -759,6 +764,10 @@ class extMeasureRC : public extMeasure
   bool _newDiagFlow;
   // dkf 10092023
   int ConnectWires(uint32_t dir);
+  // Runs func(level) for all metal levels of the search grid. Each call must
+  // only modify wires of its own level; levels run on _threadPool if set.
+  void ForEachLevel(const std::function<void(uint32_t)>& func);
+  utl::ThreadPool* _threadPool = nullptr;
   // uint32_t CalcDiag( uint32_t targetMet, uint32_t diagDist, uint32_t tgWidth,
   // uint32_t len1, extSegment *s, int rsegId); dkf 10102023
   int FindDiagonalNeighbors_down(uint32_t dir,
@@ -41,6 +41,7 @@ struct SEQ;
 
 class extSpef;
 class GridTable;
+class OdbCallBack;
 
 // CoupleOptions seriously needs to be rewriten to use a class with named
 // members. -cherry 05/09/2021
@@ -1855,6 +1856,7 @@ class extMain
   float _version;                           // dkf: 06242024
   int _metal_flag_22;                       // dkf: 06242024
   uint32_t _wire_extracted_progress_count;  // dkf: 06242024
+  int _threads = 1;  // threads for the per-level neighbor search
 
   bool _v2;  // new flow dkf: 10302023
 
@@ -2120,6 +2122,10 @@ class extMain
   void unlinkCapNode(std::vector<odb::dbNet*>& nets);
   void removeExt(std::vector<odb::dbNet*>& nets);
   void removeRSeg(std::vector<odb::dbNet*>& nets);
+  // Incremental extraction: nets changed since the last extraction are
+  // tracked through db callbacks and re-extracted with their cc halo nets.
+  bool setupIncrementalExtraction();
+  void trackNetChanges();
   void removeCapNode(std::vector<odb::dbNet*>& nets);
   void adjustRC(double resFactor, double ccFactor, double gndcFactor);
   void updatePrevControl();
@@ -2718,6 +2724,8 @@ class extMain
   bool _mergeViaRes = false;
   const char* rules_file_path_{nullptr};
   const char* target_nets_names_{nullptr};
+  std::unique_ptr<OdbCallBack> _odbCallBack;
+  std::vector<odb::dbNet*> _incrementalNets;
   bool _mergeParallelCC = false;
   bool _reportNetNoWire = false;
   int _netNoWireCnt = 0;
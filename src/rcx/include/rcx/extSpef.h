@@ -318,6 +318,8 @@ class extSpef
 
   char _outFile[1024];
   FILE* _outFP = nullptr;
+  bool _outPipe = false;
+  std::vector<char> _outBuffer;
 
   Parser* _parser = nullptr;
 
@@ -52,6 +52,7 @@ struct ExtractOptions
   bool lef_rc = false;
   bool lef_res = false;
   int _dbg = 0;
+  bool incremental = false;
 
   // v2-only variables:
   bool _v2 = false;
@@ -59,6 +60,7 @@ struct ExtractOptions
   int _wire_extracted_progress_count = 50000;
   bool over_cell = false;
   bool skip_via_wires = false;
+  int threads = 1;
 };
 
 struct SpefOptions
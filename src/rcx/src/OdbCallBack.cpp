@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#include "OdbCallBack.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "odb/db.h"
+
+namespace rcx {
+
+void OdbCallBack::setBlock(odb::dbBlock* block)
+{
+  if (block != block_ || !hasOwner()) {
+    addOwner(block);
+    block_ = block;
+  }
+  dirty_net_ids_.clear();
+}
+
+void OdbCallBack::markDirty(odb::dbNet* net)
+{
+  if (net == nullptr || net->getSigType().isSupply()) {
+    return;
+  }
+  dirty_net_ids_.insert(net->getId());
+}
+
+void OdbCallBack::inDbNetDestroy(odb::dbNet* net)
+{
+  dirty_net_ids_.erase(net->getId());
+}
+
+void OdbCallBack::inDbWireCreate(odb::dbWire* wire)
+{
+  markDirty(wire->getNet());
+}
+
+void OdbCallBack::inDbWireDestroy(odb::dbWire* wire)
+{
+  markDirty(wire->getNet());
+}
+
+void OdbCallBack::inDbWirePostModify(odb::dbWire* wire)
+{
+  markDirty(wire->getNet());
+}
+
+void OdbCallBack::inDbWirePostAttach(odb::dbWire* wire)
+{
+  markDirty(wire->getNet());
+}
+
+void OdbCallBack::inDbWirePreDetach(odb::dbWire* wire)
+{
+  markDirty(wire->getNet());
+}
+
+void OdbCallBack::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  markDirty(iterm->getNet());
+}
+
+void OdbCallBack::inDbITermPostDisconnect(odb::dbITerm* iterm,
+                                          odb::dbNet* net)
+{
+  markDirty(net);
+}
+
+void OdbCallBack::inDbBTermPostConnect(odb::dbBTerm* bterm)
+{
+  markDirty(bterm->getNet());
+}
+
+void OdbCallBack::inDbBTermPostDisConnect(odb::dbBTerm* bterm,
+                                          odb::dbNet* net)
+{
+  markDirty(net);
+}
+
+void OdbCallBack::inDbPostMoveInst(odb::dbInst* inst)
+{
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    markDirty(iterm->getNet());
+  }
+}
+
+std::vector<odb::dbNet*> OdbCallBack::getDirtyNets() const
+{
+  std::vector<odb::dbNet*> nets;
+  nets.reserve(dirty_net_ids_.size());
+  for (const uint32_t id : dirty_net_ids_) {
+    nets.push_back(odb::dbNet::getNet(block_, id));
+  }
+  return nets;
+}
+
+}  // namespace rcx
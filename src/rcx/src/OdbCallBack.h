@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2026, The OpenROAD Authors
+
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
+
+namespace rcx {
+
+// Records the signal nets whose routing or connectivity changed after an
+// extraction so that extract_parasitics -incremental can redo only those.
+class OdbCallBack : public odb::dbBlockCallBackObj
+{
+ public:
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePreDetach(odb::dbWire* wire) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
+  void inDbBTermPostConnect(odb::dbBTerm* bterm) override;
+  void inDbBTermPostDisConnect(odb::dbBTerm* bterm, odb::dbNet* net) override;
+  void inDbPostMoveInst(odb::dbInst* inst) override;
+
+  // Starts tracking block with an empty set of changed nets
+  void setBlock(odb::dbBlock* block);
+  odb::dbBlock* getBlock() const { return block_; }
+
+  // Changed nets in id order
+  std::vector<odb::dbNet*> getDirtyNets() const;
+
+ private:
+  void markDirty(odb::dbNet* net);
+
+  odb::dbBlock* block_ = nullptr;
+  std::set<uint32_t> dirty_net_ids_;
+};
+
+}  // namespace rcx
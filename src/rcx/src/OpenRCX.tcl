@@ -65,6 +65,7 @@ sta::define_cmd_args "extract_parasitics" {
     [-no_merge_via_res]
     [-skip_over_cell ]
     [-version]
+    [-incremental]
 }
 proc extract_parasitics { args } {
   sta::parse_key_args "extract_parasitics" args \
@@ -79,7 +80,7 @@ proc extract_parasitics { args } {
            -context_depth
            -version } \
     flags { -lef_res -lef_rc
-            -no_merge_via_res -skip_over_cell }
+            -no_merge_via_res -skip_over_cell -incremental }
 
   set ext_model_file ""
   if { [info exists keys(-ext_model_file)] } {
@@ -113,6 +114,7 @@ proc extract_parasitics { args } {
   set lef_res [info exists flags(-lef_res)]
   set no_merge_via_res [info exists flags(-no_merge_via_res)]
   set skip_over_cell [info exists flags(-skip_over_cell)]
+  set incremental [info exists flags(-incremental)]
 
   set cc_model 10
   if { [info exists keys(-cc_model)] } {
@@ -141,7 +143,7 @@ proc extract_parasitics { args } {
   rcx::extract $ext_model_file $corner_cnt $max_res \
     $coupling_threshold $cc_model \
     $depth $debug_net_id $lef_res $no_merge_via_res \
-    $lef_rc $skip_over_cell $version $corner $dbg
+    $lef_rc $skip_over_cell $version $corner $dbg $incremental
 }
 
 sta::define_cmd_args "write_spef" {
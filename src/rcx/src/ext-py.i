@@ -35,7 +35,8 @@ void extract(const char* ext_model_file,
         bool skip_over_cell,
         float version,
         int corner,
-        int dbg
+        int dbg,
+        bool incremental
         );
 void
 write_spef(const char* file,
@@ -214,6 +214,17 @@ void Ext::extract(ExtractOptions options)
   _ext->setBlockFromChip();
   odb::dbBlock* block = _ext->getBlock();
 
+  if (options.incremental) {
+    if (options._v2) {
+      logger_->warn(RCX,
+                    517,
+                    "-incremental is not supported with -version 2.0 or "
+                    "later; extracting all nets.");
+    } else if (!_ext->setupIncrementalExtraction()) {
+      return;
+    }
+  }
+
   odb::orderWires(logger_, block);
 
   _ext->set_debug_nets(options.debug_net);
@@ -233,6 +244,7 @@ void Ext::extract(ExtractOptions options)
     _ext->setExtractionOptions(options);
     _ext->makeBlockRCsegs();
   }
+  _ext->trackNetChanges();
 }
 
 void Ext::adjust_rc(float res_factor, float cc_factor, float gndc_factor)
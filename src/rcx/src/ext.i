@@ -47,7 +47,8 @@ extract(const char* ext_model_file,
         bool skip_over_cell,
         float version,
         int corner,
-        int dbg
+        int dbg,
+        bool incremental
         )
 {
   Ext* ext = getOpenRCX();
@@ -71,7 +72,9 @@ extract(const char* ext_model_file,
   opts._version= version;
 
   opts._dbg= dbg;
-  
+  opts.incremental = incremental;
+  opts.threads = ord::getOpenRoad()->getThreadCount();
+
   ext->extract(opts);
 }
 
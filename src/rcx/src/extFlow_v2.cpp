@@ -24,6 +24,7 @@
 #include "rcx/grids.h"
 #include "rcx/util.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 using odb::dbCapNode;
 using odb::dbInst;
@@ -202,6 +203,12 @@ uint32_t extMain::couplingFlow_v2(Rect& extRect,
 
   mrc->_seqmentPool = new AthPool<extSegment>(1024);
 
+  // Wire linking and neighbor search only touch wires of one level at a time
+  // and are distributed over the levels; coupling measurement stays serial
+  // since it creates the dbRSeg/dbCCSeg results in wire order.
+  utl::ThreadPool thread_pool(_threads > 1 ? _threads : 0);
+  mrc->_threadPool = &thread_pool;
+
   uint32_t totalWiresExtracted = 0;
   float previous_percent_extracted = 0.0;
   for (int dir = 1; dir >= 0; dir--) {  // dir==1 Horizontal wires
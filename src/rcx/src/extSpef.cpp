@@ -13,6 +13,7 @@
 #include <cstring>
 #include <ctime>
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "name.h"
@@ -124,6 +125,8 @@ extSpef::extSpef(odb::dbTech* tech,
 
 extSpef::~extSpef()
 {
+  // _outFP writes through _outBuffer, so flush it before the buffer goes
+  closeOutFile();
   delete _idMapTable;
   delete _nodeParser;
   delete _parser;
@@ -1279,12 +1282,14 @@ bool extSpef::setOutSpef(const char* filename)
     return true;
   }
 
+  closeOutFile();
   strcpy(_outFile, filename);
 
-  if (_gzipFlag) {
-    char cmd[2048];
-    sprintf(cmd, "gzip -1 > %s.gz", filename);
-    _outFP = popen(cmd, "w");
+  _outPipe = _gzipFlag;
+  if (_outPipe) {
+    const std::string cmd
+        = std::string(Parser::gzipProgram()) + " -1 > " + filename + ".gz";
+    _outFP = popen(cmd.c_str(), "w");
   } else {
     _outFP = fopen(filename, "w");
   }
@@ -1293,6 +1298,10 @@ bool extSpef::setOutSpef(const char* filename)
     fprintf(stderr, "Cannot open file %s with permissions \"w\"", filename);
     return false;
   }
+  // Nets are written with many small fprintf calls; a large buffer turns
+  // them into few big writes to the file or compressor pipe.
+  _outBuffer = std::vector<char>(Parser::_ioBufferSize);
+  setvbuf(_outFP, _outBuffer.data(), _IOFBF, _outBuffer.size());
   return true;
 }
 
@@ -1302,11 +1311,13 @@ bool extSpef::closeOutFile()
     return false;
   }
 
-  if (_gzipFlag) {
+  if (_outPipe) {
     pclose(_outFP);
   } else {
     fclose(_outFP);
   }
+  _outFP = nullptr;
+  _outPipe = false;
 
   return true;
 }
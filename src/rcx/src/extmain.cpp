@@ -2,7 +2,11 @@
 // Copyright (c) 2019-2025, The OpenROAD Authors
 
 #include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
+#include "OdbCallBack.h"
 #include "odb/db.h"
 #include "odb/dbSet.h"
 #include "rcx/array1.h"
@@ -47,6 +51,55 @@ void extMain::setExtractionOptions(const ExtractOptions& options)
   target_nets_names_ = options.net;
 }
 
+bool extMain::setupIncrementalExtraction()
+{
+  _incrementalNets.clear();
+
+  int numOfNet;
+  int numOfRSeg;
+  int numOfCapNode;
+  int numOfCCSeg;
+  _block->getExtCount(numOfNet, numOfRSeg, numOfCapNode, numOfCCSeg);
+  if (!_odbCallBack || _odbCallBack->getBlock() != _block || numOfRSeg == 0) {
+    logger_->warn(RCX,
+                  514,
+                  "No previous extraction of {} to update; extracting all "
+                  "nets.",
+                  _block->getName());
+    return true;
+  }
+
+  std::vector<dbNet*> changed = _odbCallBack->getDirtyNets();
+  if (changed.empty()) {
+    logger_->info(RCX, 515, "No nets changed since the last extraction.");
+    return false;
+  }
+
+  // Nets that coupled to a changed net lose their cc segments and are
+  // re-extracted along with it.
+  std::vector<dbNet*> halo;
+  _block->getCcHaloNets(changed, halo);
+  logger_->info(RCX,
+                516,
+                "Re-extracting {} changed nets and {} coupled nets.",
+                changed.size(),
+                halo.size());
+
+  _incrementalNets = std::move(changed);
+  _incrementalNets.insert(_incrementalNets.end(), halo.begin(), halo.end());
+  removeExt(_incrementalNets);
+  return true;
+}
+
+void extMain::trackNetChanges()
+{
+  _incrementalNets.clear();
+  if (!_odbCallBack) {
+    _odbCallBack = std::make_unique<OdbCallBack>();
+  }
+  _odbCallBack->setBlock(_block);
+}
+
 void extMain::addDummyCorners(dbBlock* block, uint32_t cnt, utl::Logger* logger)
 {
   extMain* tmiExt = (extMain*) block->getExtmi();
@@ -250,6 +250,7 @@ void extMain::setExtractionOptions_v2(ExtractOptions options)
                             // taken from LEF file; model file not required
 
   _wire_extracted_progress_count = options._wire_extracted_progress_count;
+  _threads = std::max(1, options.threads);
   _version = options._version;
   _metal_flag_22 = 0;
   // fprintf(stdout, "RC Flow Version %5.3f enabled\n", _version);
@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
+#include <vector>
 
 #include "odb/db.h"
 #include "rcx/array1.h"
@@ -13,6 +15,7 @@
 #include "rcx/extRCap.h"
 #include "rcx/grids.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 #ifdef HI_ACC_1
 #define FRINGE_UP_DOWN
@@ -31,12 +34,11 @@ int extMeasureRC::FindCouplingNeighbors(uint32_t dir,
                                         uint32_t diag_met_limit)
 {
   uint32_t limitTrackNum = 10;
-  Array1D<Wire*> firstWireTable;
 
-  uint32_t colCnt = _search->getColCnt();
-  for (uint32_t jj = 1; jj < colCnt; jj++) {
+  // Up neighbors are on the same level, so levels are searched in parallel
+  ForEachLevel([&](uint32_t jj) {
+    Array1D<Wire*> firstWireTable;
     Grid* netGrid = _search->getGrid(dir, jj);
-    firstWireTable.resetCnt();
 
     for (uint32_t tr = 0; tr < netGrid->getTrackCnt(); tr++) {
       Track* track = netGrid->getTrackPtr(tr);
@@ -82,7 +84,7 @@ int extMeasureRC::FindCouplingNeighbors(uint32_t dir,
         }
       }
     }
-  }
+  });
   FindCouplingNeighbors_down(dir, couplingDist, diag_met_limit);
   if (_extMain->_dbgOption > 1) {
     PrintAllGrids(dir, OpenPrintFile(dir, "couple"), 1);
@@ -131,11 +133,9 @@ int extMeasureRC::FindCouplingNeighbors_down(uint32_t dir,
                                              uint32_t diag_met_limit)
 {
   uint32_t limitTrackNum = 10;
-  Array1D<Wire*> firstWireTable;
-  uint32_t colCnt = _search->getColCnt();
-  for (uint32_t jj = 1; jj < colCnt; jj++) {
+  ForEachLevel([&](uint32_t jj) {
+    Array1D<Wire*> firstWireTable;
     Grid* netGrid = _search->getGrid(dir, jj);
-    firstWireTable.resetCnt();
 
     int tr = netGrid->getTrackCnt() - 1;
     for (; tr >= 0; tr--) {
@@ -172,7 +172,7 @@ int extMeasureRC::FindCouplingNeighbors_down(uint32_t dir,
         }
       }
     }
-  }
+  });
   return 0;
 }
 void extMeasureRC::ResetFirstWires(Grid* netGrid,
@@ -640,9 +640,7 @@ int extMeasureRC::ConnectWires(uint32_t dir)
 
   uint32_t cnt = 0;
 
-  uint32_t colCnt = _search->getColCnt();
-  for (uint32_t jj = 1; jj < colCnt; jj++)  // For all Layers
-  {
+  ForEachLevel([&](uint32_t jj) {  // For all Layers
     Grid* netGrid = _search->getGrid(dir, jj);
     for (uint32_t tr = 0; tr < netGrid->getTrackCnt(); tr++)  // for all  tracks
     {
@@ -662,7 +660,7 @@ int extMeasureRC::ConnectWires(uint32_t dir)
     }
     */
     }
-  }
+  });
   if (_extMain->_dbgOption > 1) {
     FILE* file = OpenPrintFile(dir, "wires");
     PrintAllGrids(dir, file, 0);
@@ -670,6 +668,21 @@ int extMeasureRC::ConnectWires(uint32_t dir)
   }
   return cnt;
 }
+void extMeasureRC::ForEachLevel(const std::function<void(uint32_t)>& func)
+{
+  const uint32_t colCnt = _search->getColCnt();
+  if (_threadPool == nullptr || _threadPool->threadCount() <= 1) {
+    for (uint32_t jj = 1; jj < colCnt; jj++) {
+      func(jj);
+    }
+    return;
+  }
+  std::vector<uint32_t> levels;
+  for (uint32_t jj = 1; jj < colCnt; jj++) {
+    levels.push_back(jj);
+  }
+  _threadPool->parallelFor(levels, [&](uint32_t jj) { func(jj); });
+}
 uint32_t extMeasureRC::ConnectAllWires(Track* track)
 {
   Array1D<Wire*> tbl(128);
@@ -1705,7 +1705,12 @@ void extMain::makeBlockRCsegs()
   _foreign = false;  // extract after read_spef
 
   std::vector<dbNet*> inets;
-  _allNet = !findSomeNet(_block, target_nets_names_, inets, logger_);
+  if (!_incrementalNets.empty()) {
+    inets = _incrementalNets;
+    _allNet = false;
+  } else {
+    _allNet = !findSomeNet(_block, target_nets_names_, inets, logger_);
+  }
   for (auto net : inets) {
     net->setMark(true);
   }
@@ -4,11 +4,15 @@
 #include "parse.h"
 
 #include <stdio.h>  // NOLINT(modernize-deprecated-headers): for popen()
+#include <unistd.h>
 
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "rcx/array1.h"
 #include "utl/Logger.h"
@@ -53,17 +57,7 @@ Parser::Parser(utl::Logger* logger)
 
 Parser::~Parser()
 {
-  if (_inFP && strlen(_inputFile) > 4
-      && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
-    char buff[1024];
-    while (!feof(_inFP)) {
-      if (fread(buff, 1, 1023, _inFP) != 1) {
-        break;
-      }
-    }
-    pclose(_inFP);
-    _inFP = nullptr;
-  }
+  closeFile();
   delete[] _inputFile;
   delete[] _line;
   delete[] _wordSeparators;
@@ -73,10 +67,6 @@ Parser::~Parser()
   }
 
   delete[] _wordArray;
-
-  if (_inFP) {
-    ath_closeFile(_inFP);
-  }
 }
 
 void Parser::init()
@@ -129,38 +119,77 @@ void Parser::addSeparator(const char* s)
 
 void Parser::openFile(const char* name)
 {
-  if (name != nullptr && strlen(name) > 4
-      && !strcmp(name + strlen(name) - 3, ".gz")) {
-    char cmd[256];
-    sprintf(cmd, "gzip -cd %s", name);
-    _inFP = popen(cmd, "r");
+  closeFile();
+  if (name != nullptr) {
     strcpy(_inputFile, name);
-  } else if (name == nullptr && strlen(_inputFile) > 4
-             && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
-    char cmd[256];
-    if (_inFP) {
-      char buff[1024];
-      while (!feof(_inFP)) {
-        if (fread(buff, 1, 1023, _inFP) != 1) {
-          break;
-        }
+  }
+
+  if (strlen(_inputFile) > 4
+      && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
+    const std::string cmd = std::string(gzipProgram()) + " -cd " + _inputFile;
+    _inFP = popen(cmd.c_str(), "r");
+    _inPipe = true;
+  } else {
+    _inFP = ath_openFile(_inputFile, "r", _logger);
+  }
+
+  if (_inFP != nullptr) {
+    // A new buffer for each stream, as the previous one is released only
+    // now that its stream is closed.
+    _inBuffer = std::vector<char>(_ioBufferSize);
+    setvbuf(_inFP, _inBuffer.data(), _IOFBF, _inBuffer.size());
+  }
+}
+
+void Parser::closeFile()
+{
+  if (_inFP == nullptr) {
+    return;
+  }
+  if (_inPipe) {
+    // Drain the pipe so the decompressor doesn't block on a full pipe
+    char buff[1024];
+    while (!feof(_inFP)) {
+      if (fread(buff, 1, 1023, _inFP) != 1) {
+        break;
       }
-      pclose(_inFP);
-      _inFP = nullptr;
     }
-    sprintf(cmd, "gzip -cd %s", _inputFile);
-    _inFP = popen(cmd, "r");
-  } else if (name != nullptr) {
-    _inFP = ath_openFile(name, "r", _logger);
-    strcpy(_inputFile, name);
-  } else {  //
-    _inFP = ath_openFile(_inputFile, "r", _logger);
+    pclose(_inFP);
+  } else {
+    ath_closeFile(_inFP);
   }
+  _inFP = nullptr;
+  _inPipe = false;
+}
+
+const char* Parser::gzipProgram()
+{
+  // Looked up in PATH directly rather than by running a shell command.
+  static const bool has_pigz = [] {
+    const char* path = std::getenv("PATH");
+    if (path == nullptr) {
+      return false;
+    }
+    std::istringstream dirs(path);
+    std::string dir;
+    while (std::getline(dirs, dir, ':')) {
+      if (dir.empty()) {
+        continue;
+      }
+      const std::filesystem::path pigz = std::filesystem::path(dir) / "pigz";
+      if (access(pigz.c_str(), X_OK) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }();
+  return has_pigz ? "pigz" : "gzip";
 }
 
 void Parser::setInputFP(FILE* fp)
 {
   _inFP = fp;
+  _inPipe = false;
 }
 
 void Parser::printWords(FILE* fp)
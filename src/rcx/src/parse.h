@@ -6,6 +6,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #include "rcx/array1.h"
 #include "utl/Logger.h"
@@ -44,11 +45,18 @@ class Parser
   int getLineNum();
   bool isDigit(int ii, int jj);
 
+  // Compressor for .gz files: pigz when installed, as it (de)compresses on
+  // several threads and produces the same format, otherwise gzip.
+  static const char* gzipProgram();
+
+  static constexpr size_t _ioBufferSize = 4 * 1024 * 1024;
+
  private:
   void init();
   void reportProgress();
   int mkWords(int jj);
   bool isSeparator(char a);
+  void closeFile();
 
   char* _line;
   char* _wordSeparators;
@@ -57,7 +65,9 @@ class Parser
   int _lineNum;
   int _currentWordCnt;
   FILE* _inFP;
+  bool _inPipe = false;
   char* _inputFile;
+  std::vector<char> _inBuffer;
 
   utl::Logger* _logger;
 
@@ -0,0 +1,81 @@
+# Check that extract_parasitics -incremental after an ECO gives the same
+# parasitics as the full extraction
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules -max_res 0 \
+  -coupling_threshold 0.1
+
+# Total and coupling capacitance of every signal net
+proc net_caps { } {
+  set caps {}
+  foreach net [[ord::get_db_block] getNets] {
+    if { [$net isSpecial] || [[$net getSigType] isSupply] } {
+      continue
+    }
+    dict set caps [$net getName] \
+      [list [$net getTotalCapacitance 0 1] [$net getTotalCouplingCap 0]]
+  }
+  return $caps
+}
+
+proc caps_match { caps1 caps2 } {
+  if { [dict size $caps1] != [dict size $caps2] } {
+    return 0
+  }
+  dict for { name values1 } $caps1 {
+    foreach value1 $values1 value2 [dict get $caps2 $name] {
+      if { abs($value1 - $value2) > 1e-6 + 1e-4 * abs($value1) } {
+        puts "$name: $values1 != [dict get $caps2 $name]"
+        return 0
+      }
+    }
+  }
+  return 1
+}
+
+set full_caps [net_caps]
+
+# ECO that ends with the original routing: an instance is moved away and
+# back and a routed wire is detached and attached again.  The nets of the
+# instance, the detached net and all their coupled nets are re-extracted.
+set block [ord::get_db_block]
+set eco_net ""
+foreach net [$block getNets] {
+  if { ![$net isSpecial] && [$net getWire] != "NULL"
+       && [llength [$net getITerms]] > 0 } {
+    set eco_net $net
+    break
+  }
+}
+set eco_inst [[lindex [$eco_net getITerms] 0] getInst]
+lassign [$eco_inst getLocation] x y
+$eco_inst setLocation [expr { $x + 2000 }] $y
+$eco_inst setLocation $x $y
+
+set wire [$eco_net getWire]
+$wire detach
+$wire attach $eco_net
+
+tee -quiet -variable report {
+  extract_parasitics -ext_model_file ext_pattern.rules -max_res 0 \
+    -coupling_threshold 0.1 -incremental
+}
+
+check "incremental extraction ran" {
+  string match "*RCX-0516*" $report
+} 1
+check "incremental matches full extraction" {
+  caps_match $full_caps [net_caps]
+} 1
+
+exit_summary
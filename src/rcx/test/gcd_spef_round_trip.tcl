@@ -0,0 +1,55 @@
+# Check that the buffered SPEF writer matches the gcd golden and that the
+# SPEF reader gives the same result for the golden, the written SPEF and
+# its gzip (read through pigz or gzip)
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules -max_res 0 \
+  -coupling_threshold 0.1
+
+set spef_file [make_result_file gcd_spef_round_trip.spef]
+write_spef $spef_file -nets ""
+check "written SPEF matches the golden" {
+  diff_files gcd.spefok $spef_file "^\\*(DATE|VERSION)"
+} 0
+
+set stream [open $spef_file rb]
+set spef [read $stream]
+close $stream
+set gz_file $spef_file.gz
+set stream [open $gz_file wb]
+puts -nonewline $stream [zlib gzip $spef]
+close $stream
+
+# Returns the read summary and the differences to the extraction that
+# diff_spef reports for the given file
+proc read_spef_diffs { file } {
+  tee -quiet -variable report [list diff_spef -file $file]
+  if { ![regexp {RCX-0444[^\n]*} $report summary] } {
+    return ""
+  }
+  set stream [open diff_spef.out r]
+  set diffs [read $stream]
+  close $stream
+  return [list $summary $diffs]
+}
+
+set golden_diffs [read_spef_diffs gcd.spefok]
+check "golden SPEF is read" { expr { $golden_diffs != "" } } 1
+check "written SPEF reads like the golden" {
+  expr { [read_spef_diffs $spef_file] == $golden_diffs }
+} 1
+check "compressed SPEF reads like the golden" {
+  expr { [read_spef_diffs $gz_file] == $golden_diffs }
+} 1
+
+exit_summary
@@ -0,0 +1,32 @@
+# Check that v2 extraction with several threads writes the same SPEF as the
+# serial extraction
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+
+proc extract_spef { threads } {
+  set_thread_count $threads
+  extract_parasitics -ext_model_file ext_pattern.rules -max_res 0 \
+    -coupling_threshold 0.1 -version 2.0 -skip_over_cell
+  set spef_file [make_result_file gcd_threads_$threads.spef]
+  write_spef $spef_file
+  return $spef_file
+}
+
+set serial_spef [extract_spef 1]
+set threaded_spef [extract_spef 4]
+
+check "threaded extraction matches serial extraction" {
+  diff_files $serial_spef $threaded_spef "^\\*(DATE|VERSION)"
+} 0
+
+exit_summary
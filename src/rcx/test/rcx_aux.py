@@ -25,7 +25,8 @@ def extract_parasitics(
     lef_rc=False,
     skip_over_cell=False,
     version=1.0,
-    dbg=0
+    dbg=0,
+    incremental=False
 ):
 
     opts = rcx.ExtractOptions()
@@ -48,6 +49,7 @@ def extract_parasitics(
     opts._version = version
 
     opts._dbg = dbg
+    opts.incremental = incremental
 
     design.getOpenRCX().extract(opts)
 
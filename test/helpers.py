@@ -116,6 +116,7 @@ def make_design(tech):
 
     # suppress grt message with the suggested adjustment
     logger.suppressMessage(utl.GRT, 303)
+    logger.suppressMessage(utl.GRT, 309)
     logger.suppressMessage(utl.GRT, 704)
 
     # suppress elapsed time messages (non-deterministic)
@@ -302,6 +302,7 @@ suppress_message ORD 30
 
 # suppress grt message with the suggested adjustment
 suppress_message GRT 303
+suppress_message GRT 309
 suppress_message GRT 704
 
 # suppress elapsed time messages (non-deterministic)